@@ -100,6 +100,9 @@ void UVivoxIntegrationSubsystem::Deinitialize()
 	}
 
 	LoggedInUserNum = INDEX_NONE;
+	VivoxApiClient.Reset();
+	VivoxUserId.Empty();
+	bVivoxLoginInFlight = false;
 
 	Super::Deinitialize();
 }
@@ -137,19 +140,45 @@ void UVivoxIntegrationSubsystem::OnLoginComplete(int32 LocalUserNum, bool bWasSu
 	}
 
 	LoggedInUserNum = LocalUserNum;
-	UE_LOG_VIVOX_INTEGRATION(Log, "OSS login successful. Logging into Vivox for user: %s", *AccelByteUserId);
-	VoiceChat->Login(ApiClient, AccelByteUserId);
+	VivoxApiClient = ApiClient;
+	VivoxUserId = AccelByteUserId;
+
+	// Request the Vivox login token now, while the game is still loading into the menu and creating its party. Vivox
+	// itself is logged into on the first party join, which picks the token up instead of requesting its own.
+	UE_LOG_VIVOX_INTEGRATION(Log, "OSS login successful. Prefetching Vivox login token for user: %s", *AccelByteUserId);
+	VoiceChat->PrefetchLoginToken(ApiClient, AccelByteUserId);
 }
 
-void UVivoxIntegrationSubsystem::OnVivoxLoginCompleted(bool bSuccess)
+void UVivoxIntegrationSubsystem::LoginToVivox()
 {
-	if (bSuccess)
+	FAccelByteVivoxVoiceChatPtr VoiceChat = FAccelByteVivoxVoiceChat::Get();
+	if (!VoiceChat.IsValid() || bVivoxLoginInFlight || !VivoxApiClient)
 	{
-		UE_LOG_VIVOX_INTEGRATION(Log, "Vivox login successful.");
+		return;
 	}
-	else
+
+	UE_LOG_VIVOX_INTEGRATION(Log, "Logging into Vivox for user: %s", *VivoxUserId);
+	bVivoxLoginInFlight = true;
+	VoiceChat->Login(VivoxApiClient, VivoxUserId);
+}
+
+void UVivoxIntegrationSubsystem::OnVivoxLoginCompleted(bool bSuccess)
+{
+	bVivoxLoginInFlight = false;
+	if (!bSuccess)
 	{
 		UE_LOG_VIVOX_INTEGRATION(Warning, "Vivox login failed.");
+		return;
+	}
+
+	UE_LOG_VIVOX_INTEGRATION(Log, "Vivox login successful.");
+
+	// Join the party channel that was waiting on the login
+	FAccelByteVivoxVoiceChatPtr VoiceChat = FAccelByteVivoxVoiceChat::Get();
+	if (VoiceChat.IsValid() && !CurrentPartyChannelName.IsEmpty() && !VoiceChat->IsInChannel(CurrentPartyChannelName))
+	{
+		UE_LOG_VIVOX_INTEGRATION(Log, "Joining Vivox channel: %s", *CurrentPartyChannelName);
+		VoiceChat->JoinChannel(CurrentPartyChannelName);
 	}
 }
 
@@ -227,8 +256,14 @@ void UVivoxIntegrationSubsystem::JoinPartyChannelFromSession(FName SessionName)
 	}
 
 	CurrentPartyChannelName = PartyChannelName;
-	UE_LOG_VIVOX_INTEGRATION(Log, "Joining Vivox channel: %s", *CurrentPartyChannelName);
+	if (!VoiceChat->IsLoggedIn())
+	{
+		// The channel is joined from OnVivoxLoginCompleted
+		LoginToVivox();
+		return;
+	}
 
+	UE_LOG_VIVOX_INTEGRATION(Log, "Joining Vivox channel: %s", *CurrentPartyChannelName);
 	VoiceChat->JoinChannel(CurrentPartyChannelName);
 }
 
@@ -14,7 +14,8 @@ DECLARE_LOG_CATEGORY_EXTERN(LogVivoxIntegration, Log, All);
 
 /**
  * Sample integration subsystem that automatically wires OSS events to Vivox:
- * - Login success -> Vivox login
+ * - Login success -> Vivox login token prefetch
+ * - First party create or join -> Vivox login, then join
  * - Party create success -> Join Vivox channel using party session ID
  * - Party destroy -> Leave Vivox channel
  */
@@ -43,9 +44,13 @@ private:
 	void OnVivoxChannelJoined(const FString& ChannelName, bool bSuccess);
 
 	// Party flow
+	void LoginToVivox();
 	void JoinPartyChannelFromSession(FName SessionName);
 
 	// State
 	int32 LoggedInUserNum = INDEX_NONE;
+	AccelByte::FApiClientPtr VivoxApiClient;
+	FString VivoxUserId;
+	bool bVivoxLoginInFlight = false;
 	FString CurrentPartyChannelName;
 };
@@ -37,6 +37,14 @@ public class AccelByteVivox : ModuleRules
         {
             PublicDefinitions.Add("VIVOX_AVAILABLE=0");
         }
+
+        // Verbose logs compile in only for Debug builds, or when a target sets ACCELBYTEVIVOX_VERBOSE_LOGGING=1 itself
+        bool bVerboseLogging = Target.Configuration == UnrealTargetConfiguration.Debug
+            || Target.Configuration == UnrealTargetConfiguration.DebugGame;
+        if (bVerboseLogging)
+        {
+            PublicDefinitions.Add("ACCELBYTEVIVOX_VERBOSE_LOGGING=1");
+        }
     }
 }
 
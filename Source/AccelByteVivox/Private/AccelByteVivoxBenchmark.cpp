@@ -0,0 +1,650 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteVivoxBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "AccelByteVivoxFakeBackend.h"
+#include "AccelByteVivoxSettings.h"
+#include "AccelByteVivoxVoiceChat.h"
+#include "Core/AccelByteMultiRegistry.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/MemoryBase.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include <atomic>
+
+namespace AccelByteVivoxBenchmark
+{
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Forwards to the allocator it wraps and counts the allocations made by one thread. Installed as GMalloc only while a
+ * case is measured. GMalloc is exchanged atomically, Inner never changes and the proxy is never destroyed, so other
+ * threads that picked it up keep forwarding to the same allocator after it is removed. Only the counted thread touches
+ * the counters.
+ */
+class FCountingMalloc final : public FMalloc
+{
+public:
+	FMalloc* const Inner;
+	int64 Allocations = 0;
+	int64 LiveBytes = 0;
+	int64 PeakLiveBytes = 0;
+
+	explicit FCountingMalloc(FMalloc* InInner)
+		: Inner(InInner)
+	{
+	}
+
+	void Install()
+	{
+		Allocations = 0;
+		LiveBytes = 0;
+		PeakLiveBytes = 0;
+		CountedThreadId.store(FPlatformTLS::GetCurrentThreadId());
+		FPlatformAtomics::InterlockedExchangePtr(reinterpret_cast<void**>(&GMalloc), this);
+	}
+
+	void Uninstall()
+	{
+		FPlatformAtomics::InterlockedExchangePtr(reinterpret_cast<void**>(&GMalloc), Inner);
+		CountedThreadId.store(0);
+	}
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		void* Result = Inner->Malloc(Count, Alignment);
+		TrackAllocation(Result, Count);
+		return Result;
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		TrackFree(Original);
+		void* Result = Inner->Realloc(Original, Count, Alignment);
+		TrackAllocation(Result, Count);
+		return Result;
+	}
+
+	virtual void Free(void* Original) override
+	{
+		TrackFree(Original);
+		Inner->Free(Original);
+	}
+
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+	virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+	virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+	virtual void UpdateStats() override { Inner->UpdateStats(); }
+	virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+	virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+	virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+	virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+	virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+private:
+	std::atomic<uint32> CountedThreadId{0};
+
+	bool IsCountedThread() const
+	{
+		return FPlatformTLS::GetCurrentThreadId() == CountedThreadId.load(std::memory_order_relaxed);
+	}
+
+	void TrackAllocation(void* Ptr, SIZE_T Count)
+	{
+		if (Ptr == nullptr || !IsCountedThread())
+		{
+			return;
+		}
+
+		SIZE_T Size = Count;
+		Inner->GetAllocationSize(Ptr, Size);
+		++Allocations;
+		LiveBytes += static_cast<int64>(Size);
+		PeakLiveBytes = FMath::Max(PeakLiveBytes, LiveBytes);
+	}
+
+	void TrackFree(void* Ptr)
+	{
+		SIZE_T Size = 0;
+		if (Ptr != nullptr && IsCountedThread() && Inner->GetAllocationSize(Ptr, Size))
+		{
+			LiveBytes -= static_cast<int64>(Size);
+		}
+	}
+};
+
+static FCountingMalloc& GetCountingMalloc()
+{
+	// First used while GMalloc is still the engine's allocator
+	static FCountingMalloc* CountingMalloc = new FCountingMalloc(GMalloc);
+	return *CountingMalloc;
+}
+#endif
+
+// Times the wrapper work done between Begin and End and counts the allocations it makes on this thread
+class FMeasurement
+{
+public:
+	void Begin()
+	{
+#if !UE_BUILD_SHIPPING
+		GetCountingMalloc().Install();
+#endif
+		StartCycles = FPlatformTime::Cycles64();
+	}
+
+	void End(int64 InEvents)
+	{
+		const uint64 EndCycles = FPlatformTime::Cycles64();
+#if !UE_BUILD_SHIPPING
+		FCountingMalloc& CountingMalloc = GetCountingMalloc();
+		CountingMalloc.Uninstall();
+		Allocations += CountingMalloc.Allocations;
+		PeakBytes = FMath::Max(PeakBytes, CountingMalloc.PeakLiveBytes);
+#endif
+
+		Cycles += EndCycles - StartCycles;
+		Events += InEvents;
+	}
+
+	FAccelByteVivoxBenchmarkResult ToResult(const TCHAR* Case, int32 Participants, int32 Channels) const
+	{
+		FAccelByteVivoxBenchmarkResult Result;
+		Result.Case = Case;
+		Result.Participants = Participants;
+		Result.Channels = Channels;
+		Result.Events = Events;
+		if (Events > 0)
+		{
+			Result.NanosecondsPerEvent = FPlatformTime::ToSeconds64(Cycles) * 1.0e9 / Events;
+			Result.AllocationsPerEvent = static_cast<double>(Allocations) / Events;
+		}
+		Result.PeakBytes = PeakBytes;
+		return Result;
+	}
+
+private:
+	uint64 StartCycles = 0;
+	uint64 Cycles = 0;
+	int64 Events = 0;
+	int64 Allocations = 0;
+	int64 PeakBytes = 0;
+};
+
+/**
+ * Holds the participant events the fake backend raises so they can be delivered to the wrapper inside a measured
+ * region, as a backend delivers them in a session. Other events go straight through.
+ */
+class FRecordingListener final : public IAccelByteVivoxBackendListener
+{
+public:
+	IAccelByteVivoxBackendListener* Target = nullptr;
+
+	void Reserve(int32 Count)
+	{
+		Calls.Reserve(Count);
+	}
+
+	// Delivers the recorded events in order and forgets them, keeping the storage
+	void Replay()
+	{
+		for (const FCall& Call : Calls)
+		{
+			switch (Call.Type)
+			{
+			case ECallType::Added:
+				Target->OnBackendParticipantAdded(Call.Channel, Call.Participant, Call.bValue);
+				break;
+			case ECallType::Removed:
+				Target->OnBackendParticipantRemoved(Call.Channel, Call.Participant);
+				break;
+			case ECallType::Updated:
+				Target->OnBackendParticipantUpdated(Call.Channel, Call.Participant, Call.bValue, Call.AudioEnergy);
+				break;
+			}
+		}
+		Calls.Reset();
+	}
+
+	virtual void OnBackendLoggedOut() override
+	{
+		Target->OnBackendLoggedOut();
+	}
+
+	virtual void OnBackendChannelDisconnected(FAccelByteVivoxChannelHandle Channel) override
+	{
+		Target->OnBackendChannelDisconnected(Channel);
+	}
+
+	virtual void OnBackendParticipantAdded(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		bool bMuted) override
+	{
+		Calls.Add({ ECallType::Added, bMuted, 0.0f, Channel, Participant });
+	}
+
+	virtual void OnBackendParticipantRemoved(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant) override
+	{
+		Calls.Add({ ECallType::Removed, false, 0.0f, Channel, Participant });
+	}
+
+	virtual void OnBackendParticipantUpdated(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		bool bSpeechDetected, float AudioEnergy) override
+	{
+		Calls.Add({ ECallType::Updated, bSpeechDetected, AudioEnergy, Channel, Participant });
+	}
+
+private:
+	enum class ECallType : uint8
+	{
+		Added,
+		Removed,
+		Updated
+	};
+
+	struct FCall
+	{
+		ECallType Type;
+		bool bValue;
+		float AudioEnergy;
+		FAccelByteVivoxChannelHandle Channel;
+		FAccelByteVivoxParticipantHandle Participant;
+	};
+
+	TArray<FCall> Calls;
+};
+
+} // namespace AccelByteVivoxBenchmark
+
+// Defined here rather than in the namespace so it can reach the wrapper's event processing as a friend
+class FAccelByteVivoxBenchmarkRunner
+{
+public:
+	FAccelByteVivoxBenchmarkRunner(const FAccelByteVivoxBenchmarkConfig& InConfig, int32 InParticipantCount)
+		: Config(InConfig)
+		, ParticipantCount(InParticipantCount)
+		, ChannelCount(FMath::Max(InConfig.ChannelCount, 1))
+		, RandomStream(InConfig.RandomSeed)
+	{
+	}
+
+	bool Run(TArray<FAccelByteVivoxBenchmarkResult>& OutResults)
+	{
+		if (!SetUp())
+		{
+			TearDown();
+			return false;
+		}
+
+		MeasureParticipantAdded(OutResults);
+		MeasureParticipantUpdated(OutResults);
+		MeasureSetPlayerMute(OutResults);
+		MeasureIsPlayerMuted(OutResults);
+		MeasureParticipantRemoved(OutResults);
+
+		TearDown();
+		return true;
+	}
+
+private:
+	const FAccelByteVivoxBenchmarkConfig& Config;
+	const int32 ParticipantCount;
+	const int32 ChannelCount;
+	FRandomStream RandomStream;
+
+	TSharedPtr<FAccelByteVivoxFakeBackend, ESPMode::ThreadSafe> Fake;
+	TSharedPtr<FAccelByteVivoxVoiceChat, ESPMode::ThreadSafe> VoiceChat;
+	AccelByteVivoxBenchmark::FRecordingListener Recorder;
+	TArray<FString> ChannelNames;
+	TArray<FString> ParticipantIds;
+
+	const FString& GetChannelName(int32 ParticipantIndex) const
+	{
+		return ChannelNames[ParticipantIndex % ChannelCount];
+	}
+
+	// Completes whatever the fake backend has due and processes the resulting events, untimed
+	void Pump()
+	{
+		for (int32 Round = 0; Round < 8; ++Round)
+		{
+			Fake->Advance(0.0f);
+			VoiceChat->Tick(0.0f);
+		}
+	}
+
+	// Hands the recorded participant events to the wrapper, then processes every queued event regardless of
+	// EventProcessingBudgetMs
+	void DeliverEvents()
+	{
+		Recorder.Replay();
+		DrainEvents();
+	}
+
+	int64 GetDroppedEvents() const
+	{
+		const FAccelByteVivoxEventQueueStats Stats = VoiceChat->GetEventQueueStats();
+		return static_cast<int64>(Stats.RosterUpdatesDropped + Stats.RosterMembershipDropped);
+	}
+
+	void DrainEvents()
+	{
+		while (VoiceChat->QueuedControlEventCount > 0 || VoiceChat->QueuedRosterEventCount > 0)
+		{
+			VoiceChat->ProcessQueuedEvents();
+		}
+	}
+
+	bool SetUp()
+	{
+		FAccelByteVivoxFakeBackendConfig FakeConfig;
+		FakeConfig.TokenLatencySeconds = 0.0f;
+		FakeConfig.LoginLatencySeconds = 0.0f;
+		FakeConfig.ConnectLatencySeconds = 0.0f;
+		FakeConfig.DisconnectLatencySeconds = 0.0f;
+		FakeConfig.MuteLatencySeconds = 0.0f;
+		FakeConfig.RandomSeed = Config.RandomSeed;
+		FakeConfig.bAdvanceOnTick = false;
+		FakeConfig.bAddLocalParticipantOnConnect = false;
+		Fake = MakeShared<FAccelByteVivoxFakeBackend, ESPMode::ThreadSafe>(FakeConfig);
+
+		VoiceChat = MakeShared<FAccelByteVivoxVoiceChat, ESPMode::ThreadSafe>();
+		VoiceChat->SetBackend(Fake);
+		VoiceChat->Initialize();
+		VoiceChat->SetMaxConcurrentChannels(0);
+		Recorder.Target = VoiceChat.Get();
+		Recorder.Reserve(ParticipantCount);
+		Fake->SetListener(&Recorder);
+
+		VoiceChat->Login(AccelByte::FMultiRegistry::GetApiClient(TEXT("AccelByteVivoxBenchmark")), TEXT("benchmark-user"));
+		Pump();
+		if (!VoiceChat->IsLoggedIn())
+		{
+			UE_LOG(LogAccelByteVivox, Error, TEXT("Benchmark: Login on the fake backend failed"));
+			return false;
+		}
+
+		for (int32 Index = 0; Index < ChannelCount; ++Index)
+		{
+			ChannelNames.Add(FString::Printf(TEXT("benchmark-%d"), Index));
+			VoiceChat->JoinChannel(ChannelNames.Last());
+		}
+		Pump();
+		for (const FString& ChannelName : ChannelNames)
+		{
+			if (!VoiceChat->IsInChannel(ChannelName))
+			{
+				UE_LOG(LogAccelByteVivox, Error, TEXT("Benchmark: Joining channel %s on the fake backend failed"), *ChannelName);
+				return false;
+			}
+		}
+
+		ParticipantIds.Reserve(ParticipantCount);
+		for (int32 Index = 0; Index < ParticipantCount; ++Index)
+		{
+			ParticipantIds.Add(FString::Printf(TEXT("benchmark-player-%d"), Index));
+		}
+
+		WarmUp();
+		return true;
+	}
+
+	// One untimed round of churn, so the measured rounds see containers already grown, as in a running session
+	void WarmUp()
+	{
+		for (int32 Index = 0; Index < ParticipantCount; ++Index)
+		{
+			Fake->InjectParticipantAdded(GetChannelName(Index), ParticipantIds[Index]);
+		}
+		DeliverEvents();
+
+		for (const bool bSpeechDetected : { true, false })
+		{
+			for (int32 Index = 0; Index < ParticipantCount; ++Index)
+			{
+				Fake->InjectParticipantUpdated(GetChannelName(Index), ParticipantIds[Index], bSpeechDetected);
+			}
+			DeliverEvents();
+		}
+
+		for (int32 Index = 0; Index < ParticipantCount; ++Index)
+		{
+			Fake->InjectParticipantRemoved(GetChannelName(Index), ParticipantIds[Index]);
+		}
+		DeliverEvents();
+	}
+
+	void TearDown()
+	{
+		if (VoiceChat.IsValid())
+		{
+			VoiceChat->Uninitialize();
+		}
+		VoiceChat.Reset();
+		Fake.Reset();
+	}
+
+	void MeasureParticipantAdded(TArray<FAccelByteVivoxBenchmarkResult>& OutResults)
+	{
+		for (int32 Index = 0; Index < ParticipantCount; ++Index)
+		{
+			Fake->InjectParticipantAdded(GetChannelName(Index), ParticipantIds[Index]);
+		}
+
+		const int64 DroppedBefore = GetDroppedEvents();
+		AccelByteVivoxBenchmark::FMeasurement Measurement;
+		Measurement.Begin();
+		DeliverEvents();
+		Measurement.End(ParticipantCount);
+		OutResults.Add(Measurement.ToResult(TEXT("ParticipantAdded"), ParticipantCount, ChannelCount));
+		OutResults.Last().DroppedEvents = GetDroppedEvents() - DroppedBefore;
+	}
+
+	void MeasureParticipantUpdated(TArray<FAccelByteVivoxBenchmarkResult>& OutResults)
+	{
+		const int64 DroppedBefore = GetDroppedEvents();
+		AccelByteVivoxBenchmark::FMeasurement Measurement;
+		for (int32 Round = 0; Round < Config.SpeechUpdatesPerParticipant; ++Round)
+		{
+			const bool bSpeechDetected = Round % 2 == 0;
+			for (int32 Index = 0; Index < ParticipantCount; ++Index)
+			{
+				const float AudioEnergy = bSpeechDetected ? RandomStream.FRandRange(0.2f, 1.0f) : 0.0f;
+				Fake->InjectParticipantUpdated(GetChannelName(Index), ParticipantIds[Index], bSpeechDetected, AudioEnergy);
+			}
+
+			Measurement.Begin();
+			DeliverEvents();
+			Measurement.End(ParticipantCount);
+		}
+		OutResults.Add(Measurement.ToResult(TEXT("ParticipantUpdated"), ParticipantCount, ChannelCount));
+		OutResults.Last().DroppedEvents = GetDroppedEvents() - DroppedBefore;
+	}
+
+	void MeasureSetPlayerMute(TArray<FAccelByteVivoxBenchmarkResult>& OutResults)
+	{
+		AccelByteVivoxBenchmark::FMeasurement Measurement;
+		for (int32 Round = 0; Round < Config.MuteCallsPerParticipant; ++Round)
+		{
+			const bool bMuted = Round % 2 == 0;
+			Measurement.Begin();
+			for (int32 Index = 0; Index < ParticipantCount; ++Index)
+			{
+				VoiceChat->SetPlayerMute(GetChannelName(Index), ParticipantIds[Index], bMuted);
+			}
+			Measurement.End(ParticipantCount);
+
+			// Completing the mute requests is backend work, not part of the call
+			Pump();
+		}
+		OutResults.Add(Measurement.ToResult(TEXT("SetPlayerMute"), ParticipantCount, ChannelCount));
+	}
+
+	void MeasureIsPlayerMuted(TArray<FAccelByteVivoxBenchmarkResult>& OutResults)
+	{
+		AccelByteVivoxBenchmark::FMeasurement Measurement;
+		Measurement.Begin();
+		for (int32 Round = 0; Round < Config.MuteCallsPerParticipant; ++Round)
+		{
+			for (int32 Index = 0; Index < ParticipantCount; ++Index)
+			{
+				VoiceChat->IsPlayerMuted(GetChannelName(Index), ParticipantIds[Index]);
+			}
+		}
+		Measurement.End(static_cast<int64>(ParticipantCount) * Config.MuteCallsPerParticipant);
+		OutResults.Add(Measurement.ToResult(TEXT("IsPlayerMuted"), ParticipantCount, ChannelCount));
+	}
+
+	void MeasureParticipantRemoved(TArray<FAccelByteVivoxBenchmarkResult>& OutResults)
+	{
+		for (int32 Index = 0; Index < ParticipantCount; ++Index)
+		{
+			Fake->InjectParticipantRemoved(GetChannelName(Index), ParticipantIds[Index]);
+		}
+
+		const int64 DroppedBefore = GetDroppedEvents();
+		AccelByteVivoxBenchmark::FMeasurement Measurement;
+		Measurement.Begin();
+		DeliverEvents();
+		Measurement.End(ParticipantCount);
+		OutResults.Add(Measurement.ToResult(TEXT("ParticipantRemoved"), ParticipantCount, ChannelCount));
+		OutResults.Last().DroppedEvents = GetDroppedEvents() - DroppedBefore;
+	}
+};
+
+TArray<FAccelByteVivoxBenchmarkResult> FAccelByteVivoxBenchmark::Run(const FAccelByteVivoxBenchmarkConfig& Config)
+{
+	check(IsInGameThread());
+
+	// Login needs a server URI even though the fake backend never connects to it
+	UAccelByteVivoxSettings* Settings = GetMutableDefault<UAccelByteVivoxSettings>();
+	const FString SavedVivoxServer = Settings->VivoxServer;
+	if (SavedVivoxServer.IsEmpty())
+	{
+		Settings->VivoxServer = TEXT("https://fake.vivox.com/api2");
+	}
+
+	// Every round is delivered in one go, so the roster queue must hold a full round of updates below their headroom
+	const int32 SavedRosterEventQueueCapacity = Settings->RosterEventQueueCapacity;
+	for (const int32 ParticipantCount : Config.ParticipantCounts)
+	{
+		Settings->RosterEventQueueCapacity = FMath::Max(Settings->RosterEventQueueCapacity, ParticipantCount * 2);
+	}
+
+	TArray<FAccelByteVivoxBenchmarkResult> Results;
+	for (const int32 ParticipantCount : Config.ParticipantCounts)
+	{
+		if (ParticipantCount <= 0)
+		{
+			continue;
+		}
+
+		FAccelByteVivoxBenchmarkRunner Runner(Config, ParticipantCount);
+		if (!Runner.Run(Results))
+		{
+			break;
+		}
+	}
+
+	Settings->VivoxServer = SavedVivoxServer;
+	Settings->RosterEventQueueCapacity = SavedRosterEventQueueCapacity;
+	return Results;
+}
+
+bool FAccelByteVivoxBenchmark::CountsAllocations()
+{
+	return !UE_BUILD_SHIPPING;
+}
+
+bool FAccelByteVivoxBenchmark::CheckParticipantPathAllocations(const TArray<FAccelByteVivoxBenchmarkResult>& Results)
+{
+	bool bAllocationFree = true;
+	for (const FAccelByteVivoxBenchmarkResult& Result : Results)
+	{
+		const bool bParticipantPath = Result.Case == TEXT("ParticipantAdded")
+			|| Result.Case == TEXT("ParticipantUpdated")
+			|| Result.Case == TEXT("ParticipantRemoved");
+		if (bParticipantPath && Result.AllocationsPerEvent > 0.0)
+		{
+			UE_LOG(LogAccelByteVivox, Error, TEXT("Benchmark %s: %d participants in %d channels made %.3f allocations/event, expected none"),
+				*Result.Case, Result.Participants, Result.Channels, Result.AllocationsPerEvent);
+			bAllocationFree = false;
+		}
+	}
+	return bAllocationFree;
+}
+
+bool FAccelByteVivoxBenchmark::CheckNoDroppedEvents(const TArray<FAccelByteVivoxBenchmarkResult>& Results)
+{
+	bool bNoneDropped = true;
+	for (const FAccelByteVivoxBenchmarkResult& Result : Results)
+	{
+		if (Result.DroppedEvents > 0)
+		{
+			UE_LOG(LogAccelByteVivox, Error, TEXT("Benchmark %s: %d participants in %d channels dropped %lld events, expected none"),
+				*Result.Case, Result.Participants, Result.Channels, Result.DroppedEvents);
+			bNoneDropped = false;
+		}
+	}
+	return bNoneDropped;
+}
+
+FString FAccelByteVivoxBenchmark::ToCsv(const TArray<FAccelByteVivoxBenchmarkResult>& Results)
+{
+	FString Csv = TEXT("Case,Participants,Channels,Events,NsPerEvent,AllocationsPerEvent,PeakBytes,DroppedEvents\n");
+	for (const FAccelByteVivoxBenchmarkResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%s,%d,%d,%lld,%.1f,%.3f,%lld,%lld\n"), *Result.Case, Result.Participants, Result.Channels,
+			Result.Events, Result.NanosecondsPerEvent, Result.AllocationsPerEvent, Result.PeakBytes, Result.DroppedEvents);
+	}
+	return Csv;
+}
+
+static void RunBenchmarkCommand(const TArray<FString>& Args)
+{
+	FAccelByteVivoxBenchmarkConfig Config;
+	if (Args.Num() > 0)
+	{
+		TArray<FString> Counts;
+		Args[0].ParseIntoArray(Counts, TEXT(","));
+		Config.ParticipantCounts.Reset();
+		for (const FString& Count : Counts)
+		{
+			Config.ParticipantCounts.Add(FCString::Atoi(*Count));
+		}
+	}
+	if (Args.Num() > 1)
+	{
+		Config.ChannelCount = FCString::Atoi(*Args[1]);
+	}
+
+	const TArray<FAccelByteVivoxBenchmarkResult> Results = FAccelByteVivoxBenchmark::Run(Config);
+	for (const FAccelByteVivoxBenchmarkResult& Result : Results)
+	{
+		UE_LOG(LogAccelByteVivox, Display, TEXT("Benchmark %s: %d participants in %d channels, %.1f ns/event, %.3f allocations/event, peak %lld bytes"),
+			*Result.Case, Result.Participants, Result.Channels, Result.NanosecondsPerEvent, Result.AllocationsPerEvent, Result.PeakBytes);
+	}
+
+	FAccelByteVivoxBenchmark::CheckParticipantPathAllocations(Results);
+	FAccelByteVivoxBenchmark::CheckNoDroppedEvents(Results);
+
+	const FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AccelByteVivox"), TEXT("Benchmark.csv"));
+	if (!FFileHelper::SaveStringToFile(FAccelByteVivoxBenchmark::ToCsv(Results), *OutputPath))
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("Benchmark: Failed to write %s"), *OutputPath);
+	}
+}
+
+static FAutoConsoleCommand AccelByteVivoxBenchmarkCommand(
+	TEXT("AccelByteVivox.Benchmark"),
+	TEXT("Times the voice wrapper's participant paths on the fake backend and writes Saved/AccelByteVivox/Benchmark.csv. ")
+	TEXT("Args: [ParticipantCounts, e.g. 10,100,500] [Channels]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&RunBenchmarkCommand));
+#endif
@@ -0,0 +1,650 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteVivoxCoreBackend.h"
+
+#if VIVOX_AVAILABLE
+#include "AccelByteVivoxSettings.h"
+#include "AccelByteVivoxVoiceChat.h"
+
+#include "Api/AccelByteVivoxAuthApi.h"
+#include "Misc/ScopeLock.h"
+#include "Models/AccelByteVivoxAuthModels.h"
+
+static EAudioFadeModel ToVivoxAudioFadeModel(EAccelByteVivoxAudioFadeModel FadeModel)
+{
+	switch (FadeModel)
+	{
+	case EAccelByteVivoxAudioFadeModel::LinearByDistance:
+		return EAudioFadeModel::LinearByDistance;
+	case EAccelByteVivoxAudioFadeModel::ExponentialByDistance:
+		return EAudioFadeModel::ExponentialByDistance;
+	default:
+		return EAudioFadeModel::InverseByDistance;
+	}
+}
+
+int32 FAccelByteVivoxCoreBackend::Initialize(IAccelByteVivoxBackendListener* InListener)
+{
+	if (VivoxVoiceClient != nullptr)
+	{
+		return Success;
+	}
+
+	FVivoxCoreModule* VivoxModule = static_cast<FVivoxCoreModule*>(
+		&FModuleManager::Get().LoadModuleChecked(TEXT("VivoxCore")));
+
+	if (VivoxModule == nullptr)
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("Failed to load VivoxCore module"));
+		return ErrorNotFound;
+	}
+
+	IClient* VoiceClient = &VivoxModule->VoiceClient();
+	VivoxCoreError Error = VoiceClient->Initialize();
+	if (Error != VxErrorSuccess)
+	{
+		return static_cast<int32>(Error);
+	}
+
+	VivoxVoiceClient = VoiceClient;
+	Listener = InListener;
+	return Success;
+}
+
+void FAccelByteVivoxCoreBackend::Uninitialize()
+{
+	if (VivoxVoiceClient == nullptr)
+	{
+		return;
+	}
+
+	TArray<FAccelByteVivoxChannelHandle> Channels;
+	{
+		FScopeLock Lock(&SessionsLock);
+		ChannelSessions.GetKeys(Channels);
+	}
+	for (const FAccelByteVivoxChannelHandle& Channel : Channels)
+	{
+		ReleaseChannel(Channel);
+	}
+
+	Logout();
+
+	PreparedLoginSession = nullptr;
+	PreparedUsername.Reset();
+
+	VivoxVoiceClient->Uninitialize();
+	VivoxVoiceClient = nullptr;
+	Listener = nullptr;
+}
+
+void FAccelByteVivoxCoreBackend::RequestToken(const AccelByte::FApiClientPtr& ApiClient, const FAccelByteVivoxTokenRequest& Request,
+	const FOnAccelByteVivoxTokenReceived& OnReceived, const FOnAccelByteVivoxTokenFailed& OnFailed)
+{
+	if (!ApiClient.IsValid())
+	{
+		OnFailed.ExecuteIfBound(ErrorInvalidState, TEXT("Invalid ApiClient"));
+		return;
+	}
+
+	// Request token from AccelByte
+	AccelByte::Api::VivoxAuth VivoxAuthApi = ApiClient->GetApi<AccelByte::Api::VivoxAuth>();
+
+	FAccelByteVivoxAuthServiceGenerateVivoxTokenRequest TokenRequest;
+	TokenRequest.Username = Request.Username;
+	if (Request.Type == EAccelByteVivoxTokenType::Join)
+	{
+		TokenRequest.Type = EAccelByteVivoxAuthServiceGenerateVivoxTokenRequestType::join;
+		TokenRequest.ChannelId = Request.ChannelName;
+		TokenRequest.ChannelType = Request.bPositional
+			? EAccelByteVivoxAuthServiceGenerateVivoxTokenRequestChannelType::positional
+			: EAccelByteVivoxAuthServiceGenerateVivoxTokenRequestChannelType::nonpositional;
+	}
+	else
+	{
+		TokenRequest.Type = EAccelByteVivoxAuthServiceGenerateVivoxTokenRequestType::login;
+	}
+
+	VivoxAuthApi.ServiceGenerateVivoxToken(
+		TokenRequest,
+		THandler<FAccelByteVivoxAuthServiceGenerateVivoxTokenResponse>::CreateLambda(
+			[OnReceived](const FAccelByteVivoxAuthServiceGenerateVivoxTokenResponse& Response)
+			{
+				OnReceived.ExecuteIfBound(Response.AccessToken, Response.Uri);
+			}),
+		FErrorHandler::CreateLambda([OnFailed](int32 ErrorCode, const FString& ErrorMessage)
+		{
+			OnFailed.ExecuteIfBound(ErrorCode, ErrorMessage);
+		})
+	);
+}
+
+void FAccelByteVivoxCoreBackend::PrepareLogin(const FString& Username)
+{
+	if (VivoxVoiceClient == nullptr || (PreparedLoginSession != nullptr && PreparedUsername == Username))
+	{
+		return;
+	}
+
+	const UAccelByteVivoxSettings* Settings = UAccelByteVivoxSettings::Get();
+	VivoxAccountId = AccountId(Settings->VivoxIssuer, Username, Settings->VivoxDomain);
+	PreparedLoginSession = &VivoxVoiceClient->GetLoginSession(VivoxAccountId);
+	PreparedUsername = Username;
+}
+
+int32 FAccelByteVivoxCoreBackend::BeginLogin(const FString& Username, const FString& Server, const FString& AccessToken,
+	const FOnAccelByteVivoxBackendCompleted& OnCompleted)
+{
+	if (VivoxVoiceClient == nullptr)
+	{
+		return ErrorInvalidState;
+	}
+
+	PrepareLogin(Username);
+	ILoginSession* LoginSession = PreparedLoginSession;
+	PreparedLoginSession = nullptr;
+	PreparedUsername.Reset();
+	{
+		FScopeLock Lock(&SessionsLock);
+		VivoxLoginSession = LoginSession;
+	}
+
+	VivoxCoreError Error = LoginSession->BeginLogin(
+		Server,
+		AccessToken,
+		ILoginSession::FOnBeginLoginCompletedDelegate::CreateRaw(
+			this, &FAccelByteVivoxCoreBackend::HandleVivoxLoginCompleted, OnCompleted));
+
+	if (Error != VxErrorSuccess)
+	{
+		FScopeLock Lock(&SessionsLock);
+		VivoxLoginSession = nullptr;
+	}
+
+	return static_cast<int32>(Error);
+}
+
+void FAccelByteVivoxCoreBackend::HandleVivoxLoginCompleted(VivoxCoreError Error, FOnAccelByteVivoxBackendCompleted OnCompleted)
+{
+	ILoginSession* LoginSession = GetLoginSession();
+	if (Error == VxErrorSuccess && LoginSession != nullptr)
+	{
+		const FDelegateHandle StateChangedHandle = LoginSession->EventStateChanged.AddRaw(
+			this, &FAccelByteVivoxCoreBackend::HandleLoginSessionStateChanged);
+
+		FScopeLock Lock(&SessionsLock);
+		LoginSessionStateChangedHandle = StateChangedHandle;
+	}
+
+	OnCompleted.ExecuteIfBound(static_cast<int32>(Error));
+}
+
+void FAccelByteVivoxCoreBackend::HandleLoginSessionStateChanged(LoginState State)
+{
+	if (State == LoginState::LoggedOut)
+	{
+		{
+			FScopeLock Lock(&SessionsLock);
+			LoginSessionStateChangedHandle.Reset();
+			VivoxLoginSession = nullptr;
+			for (const TPair<FAccelByteVivoxChannelHandle, FChannelSessionEntryRef>& Pair : ChannelSessions)
+			{
+				Pair.Value->bReleased = true;
+			}
+			ChannelSessions.Empty();
+		}
+
+		if (Listener != nullptr)
+		{
+			Listener->OnBackendLoggedOut();
+		}
+	}
+}
+
+void FAccelByteVivoxCoreBackend::Logout()
+{
+	ILoginSession* LoginSession = nullptr;
+	FDelegateHandle StateChangedHandle;
+	{
+		FScopeLock Lock(&SessionsLock);
+		Swap(LoginSession, VivoxLoginSession);
+		Swap(StateChangedHandle, LoginSessionStateChangedHandle);
+	}
+
+	if (LoginSession == nullptr)
+	{
+		return;
+	}
+
+	if (StateChangedHandle.IsValid())
+	{
+		LoginSession->EventStateChanged.Remove(StateChangedHandle);
+	}
+
+	LoginSession->Logout();
+}
+
+int32 FAccelByteVivoxCoreBackend::BeginConnect(FAccelByteVivoxChannelHandle Channel, const FString& ChannelName, const FString& AccessToken,
+	const FAccelByteVivoxPositionalProperties* PositionalProperties, const FOnAccelByteVivoxBackendCompleted& OnCompleted)
+{
+	ILoginSession* LoginSession = GetLoginSession();
+	if (LoginSession == nullptr)
+	{
+		return ErrorInvalidState;
+	}
+
+	const UAccelByteVivoxSettings* Settings = UAccelByteVivoxSettings::Get();
+	ChannelId VivoxChannelId = PositionalProperties == nullptr
+		? ChannelId(Settings->VivoxIssuer, ChannelName, Settings->VivoxDomain, ChannelType::NonPositional)
+		: ChannelId(Settings->VivoxIssuer, ChannelName, Settings->VivoxDomain, ChannelType::Positional,
+			Channel3DProperties(
+				PositionalProperties->AudibleDistance,
+				PositionalProperties->ConversationalDistance,
+				PositionalProperties->AudioFadeIntensity,
+				ToVivoxAudioFadeModel(PositionalProperties->AudioFadeModel)));
+
+	IChannelSession& ChannelSession = LoginSession->GetChannelSession(VivoxChannelId);
+
+	const FChannelSessionEntryRef Entry = MakeShared<FChannelSessionEntry, ESPMode::ThreadSafe>();
+	Entry->Channel = Channel;
+	Entry->Session = &ChannelSession;
+	{
+		FScopeLock Lock(&SessionsLock);
+		Entry->BlockedParticipantIds = BlockedParticipantIds;
+		ChannelSessions.Add(Channel, Entry);
+	}
+
+	// The handlers get the entry itself, so no participant event has to find it in ChannelSessions
+	const FDelegateHandle AddedHandle = ChannelSession.EventAfterParticipantAdded.AddRaw(
+		this, &FAccelByteVivoxCoreBackend::HandleParticipantAdded, Entry);
+	const FDelegateHandle RemovedHandle = ChannelSession.EventBeforeParticipantRemoved.AddRaw(
+		this, &FAccelByteVivoxCoreBackend::HandleParticipantRemoved, Entry);
+	const FDelegateHandle UpdatedHandle = ChannelSession.EventAfterParticipantUpdated.AddRaw(
+		this, &FAccelByteVivoxCoreBackend::HandleParticipantUpdated, Entry);
+	{
+		FScopeLock Lock(&Entry->RosterLock);
+		Entry->ParticipantAddedHandle = AddedHandle;
+		Entry->ParticipantRemovedHandle = RemovedHandle;
+		Entry->ParticipantUpdatedHandle = UpdatedHandle;
+	}
+
+	VivoxCoreError Error = ChannelSession.BeginConnect(
+		true,  // audio
+		false, // text
+		false, // switchTransmission — caller controls via SetTransmissionChannel()
+		AccessToken,
+		IChannelSession::FOnBeginConnectCompletedDelegate::CreateRaw(
+			this, &FAccelByteVivoxCoreBackend::HandleChannelConnectCompleted, Entry, OnCompleted));
+
+	return static_cast<int32>(Error);
+}
+
+void FAccelByteVivoxCoreBackend::HandleChannelConnectCompleted(VivoxCoreError Error, FChannelSessionEntryRef Entry, FOnAccelByteVivoxBackendCompleted OnCompleted)
+{
+	if (Error == VxErrorSuccess && !Entry->bReleased)
+	{
+		const FDelegateHandle StateChangedHandle = Entry->Session->EventChannelStateChanged.AddRaw(
+			this, &FAccelByteVivoxCoreBackend::HandleChannelStateChanged, Entry->Channel);
+
+		FScopeLock Lock(&Entry->RosterLock);
+		Entry->StateChangedHandle = StateChangedHandle;
+	}
+
+	OnCompleted.ExecuteIfBound(static_cast<int32>(Error));
+}
+
+void FAccelByteVivoxCoreBackend::HandleChannelStateChanged(const IChannelConnectionState& State, FAccelByteVivoxChannelHandle Channel)
+{
+	if (State.State() == ConnectionState::Disconnected && Listener != nullptr)
+	{
+		Listener->OnBackendChannelDisconnected(Channel);
+	}
+}
+
+void FAccelByteVivoxCoreBackend::Disconnect(FAccelByteVivoxChannelHandle Channel)
+{
+	if (IChannelSession* Session = GetChannelSession(Channel))
+	{
+		Session->Disconnect();
+	}
+}
+
+void FAccelByteVivoxCoreBackend::ReleaseChannel(FAccelByteVivoxChannelHandle Channel)
+{
+	FChannelSessionEntryPtr Entry;
+	ILoginSession* LoginSession = nullptr;
+	{
+		FScopeLock Lock(&SessionsLock);
+		const FChannelSessionEntryRef* Found = ChannelSessions.Find(Channel);
+		if (Found == nullptr)
+		{
+			return;
+		}
+		Entry = *Found;
+		ChannelSessions.Remove(Channel);
+		LoginSession = VivoxLoginSession;
+	}
+	Entry->bReleased = true;
+
+	FDelegateHandle AddedHandle;
+	FDelegateHandle RemovedHandle;
+	FDelegateHandle UpdatedHandle;
+	FDelegateHandle StateChangedHandle;
+	{
+		FScopeLock Lock(&Entry->RosterLock);
+		AddedHandle = Entry->ParticipantAddedHandle;
+		RemovedHandle = Entry->ParticipantRemovedHandle;
+		UpdatedHandle = Entry->ParticipantUpdatedHandle;
+		StateChangedHandle = Entry->StateChangedHandle;
+	}
+
+	Entry->Session->EventAfterParticipantAdded.Remove(AddedHandle);
+	Entry->Session->EventBeforeParticipantRemoved.Remove(RemovedHandle);
+	Entry->Session->EventAfterParticipantUpdated.Remove(UpdatedHandle);
+	if (StateChangedHandle.IsValid())
+	{
+		Entry->Session->EventChannelStateChanged.Remove(StateChangedHandle);
+	}
+
+	if (LoginSession != nullptr)
+	{
+		LoginSession->DeleteChannelSession(Entry->Session->Channel());
+	}
+}
+
+bool FAccelByteVivoxCoreBackend::GetParticipantInfo(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+	FString& OutParticipantId, FString& OutDisplayName) const
+{
+	const FChannelSessionEntryPtr Entry = FindChannelEntry(Channel);
+	if (!Entry.IsValid())
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&Entry->RosterLock);
+	const FParticipantEntry* ParticipantEntry = Entry->Participants.Find(Participant);
+	if (ParticipantEntry == nullptr)
+	{
+		return false;
+	}
+
+	OutParticipantId.Reset();
+	OutParticipantId.Append(ParticipantEntry->Id);
+	OutDisplayName.Reset();
+	OutDisplayName.Append(ParticipantEntry->DisplayName);
+	return true;
+}
+
+void FAccelByteVivoxCoreBackend::ReleaseParticipant(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant)
+{
+	const FChannelSessionEntryPtr Entry = FindChannelEntry(Channel);
+	if (!Entry.IsValid())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Entry->RosterLock);
+	const FParticipantEntry* ParticipantEntry = Entry->Participants.Find(Participant);
+	if (ParticipantEntry != nullptr && ParticipantEntry->bRemoved)
+	{
+		Entry->Participants.Remove(Participant);
+	}
+}
+
+void FAccelByteVivoxCoreBackend::SetTransmissionChannel(FAccelByteVivoxChannelHandle Channel)
+{
+	ILoginSession* LoginSession = GetLoginSession();
+	IChannelSession* Session = GetChannelSession(Channel);
+	if (LoginSession != nullptr && Session != nullptr)
+	{
+		LoginSession->SetTransmissionMode(TransmissionMode::Single, Session->Channel());
+	}
+}
+
+void FAccelByteVivoxCoreBackend::SetTransmissionToAll()
+{
+	if (ILoginSession* LoginSession = GetLoginSession())
+	{
+		LoginSession->SetTransmissionMode(TransmissionMode::All);
+	}
+}
+
+void FAccelByteVivoxCoreBackend::SetTransmissionToNone()
+{
+	if (ILoginSession* LoginSession = GetLoginSession())
+	{
+		LoginSession->SetTransmissionMode(TransmissionMode::None);
+	}
+}
+
+int32 FAccelByteVivoxCoreBackend::Set3DPosition(FAccelByteVivoxChannelHandle Channel, const FVector& SpeakerPosition,
+	const FVector& ListenerPosition, const FVector& ListenerForward, const FVector& ListenerUp)
+{
+	IChannelSession* Session = GetChannelSession(Channel);
+	if (Session == nullptr)
+	{
+		return ErrorNotFound;
+	}
+
+	return static_cast<int32>(Session->Set3DPosition(SpeakerPosition, ListenerPosition, ListenerForward, ListenerUp));
+}
+
+void FAccelByteVivoxCoreBackend::SetInputMuted(bool bMuted)
+{
+	if (VivoxVoiceClient != nullptr)
+	{
+		VivoxVoiceClient->AudioInputDevices().SetMuted(bMuted);
+	}
+}
+
+ILoginSession* FAccelByteVivoxCoreBackend::GetLoginSession() const
+{
+	FScopeLock Lock(&SessionsLock);
+	return VivoxLoginSession;
+}
+
+FAccelByteVivoxCoreBackend::FChannelSessionEntryPtr FAccelByteVivoxCoreBackend::FindChannelEntry(FAccelByteVivoxChannelHandle Channel) const
+{
+	FScopeLock Lock(&SessionsLock);
+	const FChannelSessionEntryRef* Entry = ChannelSessions.Find(Channel);
+	return Entry != nullptr ? FChannelSessionEntryPtr(*Entry) : FChannelSessionEntryPtr();
+}
+
+IChannelSession* FAccelByteVivoxCoreBackend::GetChannelSession(FAccelByteVivoxChannelHandle Channel) const
+{
+	const FChannelSessionEntryPtr Entry = FindChannelEntry(Channel);
+	return Entry.IsValid() ? Entry->Session : nullptr;
+}
+
+IParticipant* FAccelByteVivoxCoreBackend::FindParticipant(IChannelSession* Session, const FString& ParticipantId)
+{
+	return Session != nullptr ? Session->Participants().FindRef(ParticipantId) : nullptr;
+}
+
+int32 FAccelByteVivoxCoreBackend::SetChannelOutputMuted(FAccelByteVivoxChannelHandle Channel, bool bMuted)
+{
+	const FChannelSessionEntryPtr Entry = FindChannelEntry(Channel);
+	if (!Entry.IsValid() || Entry->Session == nullptr)
+	{
+		return ErrorNotFound;
+	}
+
+	IChannelSession* Session = nullptr;
+	TArray<TPair<FString, bool>> ParticipantMutes;
+	{
+		FScopeLock Lock(&Entry->RosterLock);
+		if (Entry->bOutputMuted == bMuted)
+		{
+			return Success;
+		}
+		Entry->bOutputMuted = bMuted;
+		Session = Entry->Session;
+
+		// Every live participant gets its effective state, so unmuting the channel puts each player mute back
+		ParticipantMutes.Reserve(Entry->Participants.Num());
+		for (const TPair<FAccelByteVivoxParticipantHandle, FParticipantEntry>& Pair : Entry->Participants)
+		{
+			if (!Pair.Value.bRemoved)
+			{
+				ParticipantMutes.Emplace(Pair.Value.Id, bMuted || Entry->MutedParticipants.Contains(Pair.Key));
+			}
+		}
+	}
+
+	for (const TPair<FString, bool>& ParticipantMute : ParticipantMutes)
+	{
+		if (IParticipant* VivoxParticipant = FindParticipant(Session, ParticipantMute.Key))
+		{
+			VivoxParticipant->BeginSetLocalMute(ParticipantMute.Value, IParticipant::FOnBeginSetLocalMuteCompletedDelegate());
+		}
+	}
+	return Success;
+}
+
+int32 FAccelByteVivoxCoreBackend::BeginSetParticipantMute(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+	bool bMuted, const FOnAccelByteVivoxBackendCompleted& OnCompleted)
+{
+	const FChannelSessionEntryPtr Entry = FindChannelEntry(Channel);
+	if (!Entry.IsValid())
+	{
+		return ErrorNotFound;
+	}
+
+	IChannelSession* Session = nullptr;
+	FString ParticipantId;
+	{
+		FScopeLock Lock(&Entry->RosterLock);
+		const FParticipantEntry* ParticipantEntry = Entry->Participants.Find(Participant);
+		if (ParticipantEntry == nullptr || ParticipantEntry->bRemoved)
+		{
+			return ErrorNotFound;
+		}
+		Session = Entry->Session;
+		ParticipantId = ParticipantEntry->Id;
+	}
+
+	IParticipant* VivoxParticipant = FindParticipant(Session, ParticipantId);
+	if (VivoxParticipant == nullptr)
+	{
+		return ErrorNotFound;
+	}
+
+	// The player mute is recorded apart from the channel mute, and the SDK always gets the state the two add up to
+	bool bEffectiveMuted = bMuted;
+	{
+		FScopeLock Lock(&Entry->RosterLock);
+		if (bMuted)
+		{
+			Entry->MutedParticipants.Add(Participant);
+		}
+		else
+		{
+			Entry->MutedParticipants.Remove(Participant);
+		}
+		bEffectiveMuted |= Entry->bOutputMuted;
+	}
+
+	VivoxCoreError Error = VivoxParticipant->BeginSetLocalMute(bEffectiveMuted,
+		IParticipant::FOnBeginSetLocalMuteCompletedDelegate::CreateLambda(
+			[OnCompleted](VivoxCoreError MuteError)
+			{
+				OnCompleted.ExecuteIfBound(static_cast<int32>(MuteError));
+			}));
+
+	return static_cast<int32>(Error);
+}
+
+void FAccelByteVivoxCoreBackend::SetBlockedParticipants(const TSet<FString>& ParticipantIds)
+{
+	TArray<FChannelSessionEntryRef> Entries;
+	{
+		FScopeLock Lock(&SessionsLock);
+		BlockedParticipantIds = ParticipantIds;
+		ChannelSessions.GenerateValueArray(Entries);
+	}
+
+	for (const FChannelSessionEntryRef& Entry : Entries)
+	{
+		FScopeLock Lock(&Entry->RosterLock);
+		Entry->BlockedParticipantIds = ParticipantIds;
+	}
+}
+
+void FAccelByteVivoxCoreBackend::HandleParticipantAdded(const IParticipant& Participant, FChannelSessionEntryRef Entry)
+{
+	if (Entry->bReleased)
+	{
+		return;
+	}
+
+	const FString& ParticipantId = Participant.Account().Name();
+	const FAccelByteVivoxParticipantHandle Handle(++LastParticipantHandle);
+	Entry->ParticipantHandles.Add(&Participant, Handle);
+
+	bool bOutputMuted = false;
+	bool bBlocked = false;
+	{
+		FScopeLock Lock(&Entry->RosterLock);
+		FParticipantEntry& ParticipantEntry = Entry->Participants.Add(Handle);
+		ParticipantEntry.Id = ParticipantId;
+		ParticipantEntry.DisplayName = Participant.Account().DisplayName();
+		bOutputMuted = Entry->bOutputMuted;
+
+		// Blocked players are muted here rather than when the wrapper gets to the event, so they are never heard
+		bBlocked = Entry->BlockedParticipantIds.Num() > 0 && Entry->BlockedParticipantIds.Contains(ParticipantId);
+		if (bBlocked)
+		{
+			Entry->MutedParticipants.Add(Handle);
+		}
+	}
+
+	if (bOutputMuted || bBlocked)
+	{
+		if (IParticipant* VivoxParticipant = FindParticipant(Entry->Session, ParticipantId))
+		{
+			VivoxParticipant->BeginSetLocalMute(true, IParticipant::FOnBeginSetLocalMuteCompletedDelegate());
+		}
+	}
+
+	if (Listener != nullptr)
+	{
+		Listener->OnBackendParticipantAdded(Entry->Channel, Handle, bBlocked);
+	}
+}
+
+void FAccelByteVivoxCoreBackend::HandleParticipantRemoved(const IParticipant& Participant, FChannelSessionEntryRef Entry)
+{
+	FAccelByteVivoxParticipantHandle Handle;
+	if (Entry->bReleased || !Entry->ParticipantHandles.RemoveAndCopyValue(&Participant, Handle))
+	{
+		return;
+	}
+
+	{
+		FScopeLock Lock(&Entry->RosterLock);
+		// The strings stay until the wrapper has processed the event and calls ReleaseParticipant
+		if (FParticipantEntry* ParticipantEntry = Entry->Participants.Find(Handle))
+		{
+			ParticipantEntry->bRemoved = true;
+		}
+		Entry->MutedParticipants.Remove(Handle);
+	}
+
+	if (Listener != nullptr)
+	{
+		Listener->OnBackendParticipantRemoved(Entry->Channel, Handle);
+	}
+}
+
+void FAccelByteVivoxCoreBackend::HandleParticipantUpdated(const IParticipant& Participant, FChannelSessionEntryRef Entry)
+{
+	// The hot path: no lock, and no lookup beyond this channel's own handle map
+	const FAccelByteVivoxParticipantHandle* Handle = Entry->bReleased ? nullptr : Entry->ParticipantHandles.Find(&Participant);
+	if (Handle != nullptr && Listener != nullptr)
+	{
+		Listener->OnBackendParticipantUpdated(Entry->Channel, *Handle, Participant.SpeechDetected(), static_cast<float>(Participant.AudioEnergy()));
+	}
+}
+#endif
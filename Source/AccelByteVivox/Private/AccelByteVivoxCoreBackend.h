@@ -0,0 +1,139 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AccelByteVivoxBackend.h"
+
+#if VIVOX_AVAILABLE
+#include "HAL/CriticalSection.h"
+#include "VivoxCore.h"
+
+#include <atomic>
+
+/**
+ * Backend that drives the VivoxCore SDK and requests tokens through AccelByte VivoxAuth.
+ *
+ * SDK events may arrive on a thread other than the game thread. Each channel session's delegates carry its entry as
+ * their payload, so participant callbacks never look up the session table or take SessionsLock. Speech updates take
+ * no lock at all; adds and removes take only their own channel's RosterLock to publish the roster to the game thread.
+ * No lock is held across a call into the SDK or the listener.
+ */
+class FAccelByteVivoxCoreBackend : public IAccelByteVivoxBackend
+{
+public:
+	virtual const TCHAR* GetName() const override { return TEXT("VivoxCore"); }
+
+	virtual int32 Initialize(IAccelByteVivoxBackendListener* InListener) override;
+	virtual void Uninitialize() override;
+
+	virtual void RequestToken(const AccelByte::FApiClientPtr& ApiClient, const FAccelByteVivoxTokenRequest& Request,
+		const FOnAccelByteVivoxTokenReceived& OnReceived, const FOnAccelByteVivoxTokenFailed& OnFailed) override;
+
+	virtual void PrepareLogin(const FString& Username) override;
+	virtual int32 BeginLogin(const FString& Username, const FString& Server, const FString& AccessToken,
+		const FOnAccelByteVivoxBackendCompleted& OnCompleted) override;
+	virtual void Logout() override;
+
+	virtual int32 BeginConnect(FAccelByteVivoxChannelHandle Channel, const FString& ChannelName, const FString& AccessToken,
+		const FAccelByteVivoxPositionalProperties* PositionalProperties, const FOnAccelByteVivoxBackendCompleted& OnCompleted) override;
+	virtual void Disconnect(FAccelByteVivoxChannelHandle Channel) override;
+	virtual void ReleaseChannel(FAccelByteVivoxChannelHandle Channel) override;
+
+	virtual bool GetParticipantInfo(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		FString& OutParticipantId, FString& OutDisplayName) const override;
+	virtual void ReleaseParticipant(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant) override;
+
+	virtual void SetTransmissionChannel(FAccelByteVivoxChannelHandle Channel) override;
+	virtual void SetTransmissionToAll() override;
+	virtual void SetTransmissionToNone() override;
+
+	virtual int32 Set3DPosition(FAccelByteVivoxChannelHandle Channel, const FVector& SpeakerPosition, const FVector& ListenerPosition,
+		const FVector& ListenerForward, const FVector& ListenerUp) override;
+
+	virtual void SetInputMuted(bool bMuted) override;
+	virtual int32 SetChannelOutputMuted(FAccelByteVivoxChannelHandle Channel, bool bMuted) override;
+	virtual int32 BeginSetParticipantMute(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		bool bMuted, const FOnAccelByteVivoxBackendCompleted& OnCompleted) override;
+	virtual void SetBlockedParticipants(const TSet<FString>& ParticipantIds) override;
+
+private:
+	struct FParticipantEntry
+	{
+		FString Id;
+		FString DisplayName;
+		// Gone from the SDK roster, and only kept so the wrapper can still read its strings
+		bool bRemoved = false;
+	};
+
+	struct FChannelSessionEntry
+	{
+		FAccelByteVivoxChannelHandle Channel;
+		IChannelSession* Session = nullptr;
+		// Set once the channel is released or its login session is gone; late SDK callbacks are then ignored
+		std::atomic<bool> bReleased{false};
+
+		// Only touched by this session's participant callbacks, which VivoxCore raises one at a time, so updates
+		// resolve their handle without a lock. Keyed by participant address so updates never touch account name strings.
+		TMap<const IParticipant*, FAccelByteVivoxParticipantHandle> ParticipantHandles;
+
+		// Guards everything below, which participant adds and removes share with the game thread
+		mutable FCriticalSection RosterLock;
+		TMap<FAccelByteVivoxParticipantHandle, FParticipantEntry> Participants;
+
+		// VivoxCore has no per-channel output mute, so it is done by muting every participant locally. MutedParticipants
+		// are the player mutes set through BeginSetParticipantMute or the block list, kept apart from bOutputMuted. A
+		// participant's local mute is always bOutputMuted || MutedParticipants.Contains, and is re-applied on unmute.
+		bool bOutputMuted = false;
+		TSet<FAccelByteVivoxParticipantHandle> MutedParticipants;
+
+		// Copy of the block list, so an add never reads state shared with other channels
+		TSet<FString> BlockedParticipantIds;
+
+		FDelegateHandle ParticipantAddedHandle;
+		FDelegateHandle ParticipantRemovedHandle;
+		FDelegateHandle ParticipantUpdatedHandle;
+		FDelegateHandle StateChangedHandle;
+	};
+
+	// Shared between ChannelSessions and the payloads of the session's delegates
+	using FChannelSessionEntryRef = TSharedRef<FChannelSessionEntry, ESPMode::ThreadSafe>;
+	using FChannelSessionEntryPtr = TSharedPtr<FChannelSessionEntry, ESPMode::ThreadSafe>;
+
+	IAccelByteVivoxBackendListener* Listener = nullptr;
+	IClient* VivoxVoiceClient = nullptr;
+
+	// Guards VivoxLoginSession, LoginSessionStateChangedHandle, BlockedParticipantIds and ChannelSessions; never taken
+	// by participant callbacks
+	mutable FCriticalSection SessionsLock;
+	ILoginSession* VivoxLoginSession = nullptr;
+	// Session fetched by PrepareLogin, picked up by the next BeginLogin for the same user
+	ILoginSession* PreparedLoginSession = nullptr;
+	FString PreparedUsername;
+	AccountId VivoxAccountId;
+	TMap<FAccelByteVivoxChannelHandle, FChannelSessionEntryRef> ChannelSessions;
+	TSet<FString> BlockedParticipantIds;
+	std::atomic<uint32> LastParticipantHandle{0};
+
+	// Delegate handles for cleanup
+	FDelegateHandle LoginSessionStateChangedHandle;
+
+	ILoginSession* GetLoginSession() const;
+	FChannelSessionEntryPtr FindChannelEntry(FAccelByteVivoxChannelHandle Channel) const;
+	IChannelSession* GetChannelSession(FAccelByteVivoxChannelHandle Channel) const;
+	// Looked up outside SessionsLock; the SDK owns the participant
+	static IParticipant* FindParticipant(IChannelSession* Session, const FString& ParticipantId);
+
+	void HandleVivoxLoginCompleted(VivoxCoreError Error, FOnAccelByteVivoxBackendCompleted OnCompleted);
+	void HandleLoginSessionStateChanged(LoginState State);
+	void HandleChannelConnectCompleted(VivoxCoreError Error, FChannelSessionEntryRef Entry, FOnAccelByteVivoxBackendCompleted OnCompleted);
+	void HandleChannelStateChanged(const IChannelConnectionState& State, FAccelByteVivoxChannelHandle Channel);
+
+	// Participant event handlers
+	void HandleParticipantAdded(const IParticipant& Participant, FChannelSessionEntryRef Entry);
+	void HandleParticipantRemoved(const IParticipant& Participant, FChannelSessionEntryRef Entry);
+	void HandleParticipantUpdated(const IParticipant& Participant, FChannelSessionEntryRef Entry);
+};
+#endif
@@ -0,0 +1,528 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteVivoxFakeBackend.h"
+
+#if ACCELBYTEVIVOX_WITH_FAKE_BACKEND
+FAccelByteVivoxFakeBackend::FAccelByteVivoxFakeBackend(const FAccelByteVivoxFakeBackendConfig& InConfig)
+	: Config(InConfig)
+	, RandomStream(InConfig.RandomSeed)
+{
+}
+
+int32 FAccelByteVivoxFakeBackend::Initialize(IAccelByteVivoxBackendListener* InListener)
+{
+	Listener = InListener;
+	bInitialized = true;
+	return Success;
+}
+
+void FAccelByteVivoxFakeBackend::Uninitialize()
+{
+	ScheduledActions.Empty();
+	PendingFailures.Empty();
+	Channels.Empty();
+	ChannelNames.Empty();
+	TransmissionChannel.Reset();
+	bLoggedIn = false;
+	bInitialized = false;
+	Listener = nullptr;
+	++LoginEpoch;
+}
+
+void FAccelByteVivoxFakeBackend::Tick(float DeltaSeconds)
+{
+	if (Config.bAdvanceOnTick)
+	{
+		Advance(DeltaSeconds);
+	}
+}
+
+void FAccelByteVivoxFakeBackend::Advance(float Seconds)
+{
+	const double TargetTime = Now + FMath::Max(Seconds, 0.0f);
+	while (ScheduledActions.Num() > 0 && ScheduledActions.HeapTop().Time <= TargetTime)
+	{
+		FScheduledAction Next;
+		ScheduledActions.HeapPop(Next, &FAccelByteVivoxFakeBackend::IsDueBefore);
+		Now = Next.Time;
+		Next.Action();
+	}
+	Now = TargetTime;
+}
+
+bool FAccelByteVivoxFakeBackend::IsDueBefore(const FScheduledAction& A, const FScheduledAction& B)
+{
+	return A.Time < B.Time || (A.Time == B.Time && A.Sequence < B.Sequence);
+}
+
+void FAccelByteVivoxFakeBackend::Schedule(float LatencySeconds, TFunction<void()>&& Action)
+{
+	float Delay = FMath::Max(LatencySeconds, 0.0f);
+	if (Config.LatencyJitterSeconds > 0.0f)
+	{
+		Delay += RandomStream.FRandRange(0.0f, Config.LatencyJitterSeconds);
+	}
+
+	FScheduledAction ScheduledAction;
+	ScheduledAction.Time = Now + Delay;
+	ScheduledAction.Sequence = NextSequence++;
+	ScheduledAction.Action = MoveTemp(Action);
+	ScheduledActions.HeapPush(MoveTemp(ScheduledAction), &FAccelByteVivoxFakeBackend::IsDueBefore);
+}
+
+void FAccelByteVivoxFakeBackend::FailNextOperation(EAccelByteVivoxFakeOperation Operation, int32 ErrorCode)
+{
+	PendingFailures.Add(Operation, ErrorCode);
+}
+
+int32 FAccelByteVivoxFakeBackend::ConsumeFailure(EAccelByteVivoxFakeOperation Operation)
+{
+	int32 ErrorCode = Success;
+	PendingFailures.RemoveAndCopyValue(Operation, ErrorCode);
+	return ErrorCode;
+}
+
+void FAccelByteVivoxFakeBackend::RequestToken(const AccelByte::FApiClientPtr& ApiClient, const FAccelByteVivoxTokenRequest& Request,
+	const FOnAccelByteVivoxTokenReceived& OnReceived, const FOnAccelByteVivoxTokenFailed& OnFailed)
+{
+	++Stats.TokenRequests;
+
+	const int32 Error = ConsumeFailure(EAccelByteVivoxFakeOperation::Token);
+	const FString AccessToken = FString::Printf(TEXT("fake-token-%llu"), ++NextTokenId);
+	const FString Uri = Request.Type == EAccelByteVivoxTokenType::Join
+		? FString::Printf(TEXT("sip:confctl-g-%s@fake.vivox.com"), *Request.ChannelName)
+		: FString(TEXT("https://fake.vivox.com/api2"));
+
+	Schedule(Config.TokenLatencySeconds, [Error, AccessToken, Uri, OnReceived, OnFailed]()
+	{
+		if (Error != Success)
+		{
+			OnFailed.ExecuteIfBound(Error, TEXT("Injected token failure"));
+			return;
+		}
+		OnReceived.ExecuteIfBound(AccessToken, Uri);
+	});
+}
+
+int32 FAccelByteVivoxFakeBackend::BeginLogin(const FString& Username, const FString& Server, const FString& AccessToken,
+	const FOnAccelByteVivoxBackendCompleted& OnCompleted)
+{
+	if (!bInitialized)
+	{
+		return ErrorInvalidState;
+	}
+
+	++Stats.LoginRequests;
+	LoggedInUsername = Username;
+
+	const int32 Error = ConsumeFailure(EAccelByteVivoxFakeOperation::Login);
+	const uint32 Epoch = LoginEpoch;
+	Schedule(Config.LoginLatencySeconds, [this, Error, Epoch, OnCompleted]()
+	{
+		if (Epoch != LoginEpoch)
+		{
+			// Logged out before the login completed
+			return;
+		}
+
+		bLoggedIn = Error == Success;
+		OnCompleted.ExecuteIfBound(Error);
+	});
+
+	return Success;
+}
+
+void FAccelByteVivoxFakeBackend::Logout()
+{
+	bLoggedIn = false;
+	Channels.Empty();
+	ChannelNames.Empty();
+	TransmissionChannel.Reset();
+	++LoginEpoch;
+}
+
+int32 FAccelByteVivoxFakeBackend::BeginConnect(FAccelByteVivoxChannelHandle Channel, const FString& ChannelName, const FString& AccessToken,
+	const FAccelByteVivoxPositionalProperties* PositionalProperties, const FOnAccelByteVivoxBackendCompleted& OnCompleted)
+{
+	if (!bLoggedIn)
+	{
+		return ErrorInvalidState;
+	}
+
+	++Stats.ConnectRequests;
+	RemoveChannel(ChannelName);
+	FFakeChannel& NewChannel = Channels.Add(ChannelName);
+	NewChannel.Handle = Channel;
+	NewChannel.bPositional = PositionalProperties != nullptr;
+	ChannelNames.Add(Channel, ChannelName);
+
+	const int32 Error = ConsumeFailure(EAccelByteVivoxFakeOperation::Connect);
+	Schedule(Config.ConnectLatencySeconds, [this, ChannelName, Error, OnCompleted]()
+	{
+		FFakeChannel* FakeChannel = Channels.Find(ChannelName);
+		if (FakeChannel == nullptr)
+		{
+			// Released before the connect completed
+			OnCompleted.ExecuteIfBound(ErrorNotFound);
+			return;
+		}
+
+		if (Error != Success)
+		{
+			RemoveChannel(ChannelName);
+			OnCompleted.ExecuteIfBound(Error);
+			return;
+		}
+
+		FakeChannel->bConnected = true;
+		OnCompleted.ExecuteIfBound(Success);
+
+		if (Config.bAddLocalParticipantOnConnect)
+		{
+			InjectParticipantAdded(ChannelName, LoggedInUsername, LoggedInUsername);
+		}
+	});
+
+	return Success;
+}
+
+void FAccelByteVivoxFakeBackend::Disconnect(FAccelByteVivoxChannelHandle Channel)
+{
+	FString ChannelName;
+	if (FindChannel(Channel, &ChannelName) == nullptr)
+	{
+		return;
+	}
+
+	++Stats.DisconnectRequests;
+	Schedule(Config.DisconnectLatencySeconds, [this, Channel, ChannelName]()
+	{
+		// Skip if the channel was released or rejoined under a new handle meanwhile
+		if (ChannelNames.Contains(Channel))
+		{
+			InjectChannelDisconnected(ChannelName);
+		}
+	});
+}
+
+void FAccelByteVivoxFakeBackend::ReleaseChannel(FAccelByteVivoxChannelHandle Channel)
+{
+	FString ChannelName;
+	if (FindChannel(Channel, &ChannelName) != nullptr)
+	{
+		RemoveChannel(ChannelName);
+	}
+}
+
+bool FAccelByteVivoxFakeBackend::RemoveChannel(const FString& ChannelName)
+{
+	FFakeChannel FakeChannel;
+	if (!Channels.RemoveAndCopyValue(ChannelName, FakeChannel))
+	{
+		return false;
+	}
+
+	ChannelNames.Remove(FakeChannel.Handle);
+	if (TransmissionChannel == ChannelName)
+	{
+		TransmissionChannel.Reset();
+	}
+	return true;
+}
+
+FAccelByteVivoxFakeBackend::FFakeChannel* FAccelByteVivoxFakeBackend::FindChannel(FAccelByteVivoxChannelHandle Channel, FString* OutChannelName)
+{
+	const FString* ChannelName = ChannelNames.Find(Channel);
+	if (ChannelName == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (OutChannelName != nullptr)
+	{
+		*OutChannelName = *ChannelName;
+	}
+	return Channels.Find(*ChannelName);
+}
+
+const FAccelByteVivoxFakeBackend::FFakeChannel* FAccelByteVivoxFakeBackend::FindChannel(FAccelByteVivoxChannelHandle Channel) const
+{
+	const FString* ChannelName = ChannelNames.Find(Channel);
+	return ChannelName != nullptr ? Channels.Find(*ChannelName) : nullptr;
+}
+
+const FAccelByteVivoxFakeBackend::FFakeParticipant* FAccelByteVivoxFakeBackend::FindParticipant(const FFakeChannel& Channel,
+	FAccelByteVivoxParticipantHandle Participant, FString* OutParticipantId)
+{
+	// A removed participant is still reported until released, and may have rejoined under a new handle
+	const FReportedParticipant* Reported = Channel.ReportedParticipants.Find(Participant);
+	const FFakeParticipant* FakeParticipant = Reported != nullptr ? Channel.Participants.Find(Reported->Id) : nullptr;
+	if (FakeParticipant == nullptr || FakeParticipant->Handle != Participant)
+	{
+		return nullptr;
+	}
+
+	if (OutParticipantId != nullptr)
+	{
+		*OutParticipantId = Reported->Id;
+	}
+	return FakeParticipant;
+}
+
+bool FAccelByteVivoxFakeBackend::GetParticipantInfo(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+	FString& OutParticipantId, FString& OutDisplayName) const
+{
+	const FFakeChannel* FakeChannel = FindChannel(Channel);
+	const FReportedParticipant* Reported = FakeChannel != nullptr ? FakeChannel->ReportedParticipants.Find(Participant) : nullptr;
+	if (Reported == nullptr)
+	{
+		return false;
+	}
+
+	OutParticipantId.Reset();
+	OutParticipantId.Append(Reported->Id);
+	OutDisplayName.Reset();
+	OutDisplayName.Append(Reported->DisplayName);
+	return true;
+}
+
+void FAccelByteVivoxFakeBackend::ReleaseParticipant(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant)
+{
+	FFakeChannel* FakeChannel = FindChannel(Channel);
+	if (FakeChannel != nullptr && FindParticipant(*FakeChannel, Participant) == nullptr)
+	{
+		FakeChannel->ReportedParticipants.Remove(Participant);
+	}
+}
+
+void FAccelByteVivoxFakeBackend::SetTransmissionChannel(FAccelByteVivoxChannelHandle Channel)
+{
+	FString ChannelName;
+	if (FindChannel(Channel, &ChannelName) != nullptr)
+	{
+		TransmissionChannel = ChannelName;
+		bTransmitToAll = false;
+	}
+}
+
+void FAccelByteVivoxFakeBackend::SetTransmissionToAll()
+{
+	TransmissionChannel.Reset();
+	bTransmitToAll = true;
+}
+
+void FAccelByteVivoxFakeBackend::SetTransmissionToNone()
+{
+	TransmissionChannel.Reset();
+	bTransmitToAll = false;
+}
+
+int32 FAccelByteVivoxFakeBackend::Set3DPosition(FAccelByteVivoxChannelHandle Channel, const FVector& SpeakerPosition,
+	const FVector& ListenerPosition, const FVector& ListenerForward, const FVector& ListenerUp)
+{
+	FFakeChannel* FakeChannel = FindChannel(Channel);
+	if (FakeChannel == nullptr)
+	{
+		return ErrorNotFound;
+	}
+
+	if (!FakeChannel->bPositional || !FakeChannel->bConnected)
+	{
+		return ErrorInvalidState;
+	}
+
+	++Stats.PositionUpdates;
+	FakeChannel->ListenerPosition = ListenerPosition;
+	return Success;
+}
+
+void FAccelByteVivoxFakeBackend::SetInputMuted(bool bMuted)
+{
+	bInputMuted = bMuted;
+}
+
+int32 FAccelByteVivoxFakeBackend::SetChannelOutputMuted(FAccelByteVivoxChannelHandle Channel, bool bMuted)
+{
+	FFakeChannel* FakeChannel = FindChannel(Channel);
+	if (FakeChannel == nullptr)
+	{
+		return ErrorNotFound;
+	}
+
+	FakeChannel->bOutputMuted = bMuted;
+	return Success;
+}
+
+int32 FAccelByteVivoxFakeBackend::BeginSetParticipantMute(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+	bool bMuted, const FOnAccelByteVivoxBackendCompleted& OnCompleted)
+{
+	FString ChannelName;
+	FString ParticipantId;
+	const FFakeChannel* FakeChannel = FindChannel(Channel, &ChannelName);
+	if (FakeChannel == nullptr || FindParticipant(*FakeChannel, Participant, &ParticipantId) == nullptr)
+	{
+		return ErrorNotFound;
+	}
+
+	++Stats.MuteRequests;
+
+	const int32 Error = ConsumeFailure(EAccelByteVivoxFakeOperation::Mute);
+	Schedule(Config.MuteLatencySeconds, [this, ChannelName, ParticipantId, bMuted, Error, OnCompleted]()
+	{
+		FFakeChannel* MuteChannel = Channels.Find(ChannelName);
+		FFakeParticipant* MuteParticipant = MuteChannel != nullptr ? MuteChannel->Participants.Find(ParticipantId) : nullptr;
+		if (MuteParticipant == nullptr)
+		{
+			OnCompleted.ExecuteIfBound(ErrorNotFound);
+			return;
+		}
+
+		if (Error == Success)
+		{
+			MuteParticipant->bMuted = bMuted;
+		}
+		OnCompleted.ExecuteIfBound(Error);
+	});
+
+	return Success;
+}
+
+void FAccelByteVivoxFakeBackend::SetBlockedParticipants(const TSet<FString>& ParticipantIds)
+{
+	BlockedParticipantIds = ParticipantIds;
+}
+
+bool FAccelByteVivoxFakeBackend::IsParticipantMuted(const FString& ChannelName, const FString& ParticipantId) const
+{
+	const FFakeChannel* FakeChannel = Channels.Find(ChannelName);
+	const FFakeParticipant* FakeParticipant = FakeChannel != nullptr ? FakeChannel->Participants.Find(ParticipantId) : nullptr;
+	return FakeParticipant != nullptr && FakeParticipant->bMuted;
+}
+
+bool FAccelByteVivoxFakeBackend::InjectParticipantAdded(const FString& ChannelName, const FString& ParticipantId, const FString& DisplayName)
+{
+	FFakeChannel* FakeChannel = Channels.Find(ChannelName);
+	if (FakeChannel == nullptr || !FakeChannel->bConnected || FakeChannel->Participants.Contains(ParticipantId))
+	{
+		return false;
+	}
+
+	FFakeParticipant& Participant = FakeChannel->Participants.Add(ParticipantId);
+	Participant.Handle = FAccelByteVivoxParticipantHandle(++LastParticipantHandle);
+	Participant.DisplayName = DisplayName.IsEmpty() ? ParticipantId : DisplayName;
+	Participant.bMuted = BlockedParticipantIds.Contains(ParticipantId);
+
+	FReportedParticipant& Reported = FakeChannel->ReportedParticipants.Add(Participant.Handle);
+	Reported.Id = ParticipantId;
+	Reported.DisplayName = Participant.DisplayName;
+
+	if (Listener != nullptr)
+	{
+		Listener->OnBackendParticipantAdded(FakeChannel->Handle, Participant.Handle, Participant.bMuted);
+	}
+	return true;
+}
+
+bool FAccelByteVivoxFakeBackend::InjectParticipantRemoved(const FString& ChannelName, const FString& ParticipantId)
+{
+	FFakeChannel* FakeChannel = Channels.Find(ChannelName);
+	const FFakeParticipant* Participant = FakeChannel != nullptr ? FakeChannel->Participants.Find(ParticipantId) : nullptr;
+	if (Participant == nullptr)
+	{
+		return false;
+	}
+
+	// The id and display name stay in ReportedParticipants until the listener releases the participant
+	const FAccelByteVivoxChannelHandle Channel = FakeChannel->Handle;
+	const FAccelByteVivoxParticipantHandle Handle = Participant->Handle;
+	FakeChannel->Participants.Remove(ParticipantId);
+
+	if (Listener != nullptr)
+	{
+		Listener->OnBackendParticipantRemoved(Channel, Handle);
+	}
+	return true;
+}
+
+bool FAccelByteVivoxFakeBackend::InjectParticipantUpdated(const FString& ChannelName, const FString& ParticipantId, bool bSpeechDetected, float AudioEnergy)
+{
+	const FFakeChannel* FakeChannel = Channels.Find(ChannelName);
+	const FFakeParticipant* Participant = FakeChannel != nullptr ? FakeChannel->Participants.Find(ParticipantId) : nullptr;
+	if (Participant == nullptr)
+	{
+		return false;
+	}
+
+	if (Listener != nullptr)
+	{
+		Listener->OnBackendParticipantUpdated(FakeChannel->Handle, Participant->Handle, bSpeechDetected, AudioEnergy);
+	}
+	return true;
+}
+
+bool FAccelByteVivoxFakeBackend::InjectChannelDisconnected(const FString& ChannelName)
+{
+	const FFakeChannel* FakeChannel = Channels.Find(ChannelName);
+	if (FakeChannel == nullptr)
+	{
+		return false;
+	}
+
+	const FAccelByteVivoxChannelHandle Channel = FakeChannel->Handle;
+	RemoveChannel(ChannelName);
+
+	if (Listener != nullptr)
+	{
+		Listener->OnBackendChannelDisconnected(Channel);
+	}
+	return true;
+}
+
+bool FAccelByteVivoxFakeBackend::InjectLoggedOut()
+{
+	if (!bLoggedIn)
+	{
+		return false;
+	}
+
+	Logout();
+
+	if (Listener != nullptr)
+	{
+		Listener->OnBackendLoggedOut();
+	}
+	return true;
+}
+
+bool FAccelByteVivoxFakeBackend::IsChannelConnected(const FString& ChannelName) const
+{
+	const FFakeChannel* Channel = Channels.Find(ChannelName);
+	return Channel != nullptr && Channel->bConnected;
+}
+
+bool FAccelByteVivoxFakeBackend::IsChannelPositional(const FString& ChannelName) const
+{
+	const FFakeChannel* Channel = Channels.Find(ChannelName);
+	return Channel != nullptr && Channel->bPositional;
+}
+
+bool FAccelByteVivoxFakeBackend::IsChannelOutputMuted(const FString& ChannelName) const
+{
+	const FFakeChannel* Channel = Channels.Find(ChannelName);
+	return Channel != nullptr && Channel->bOutputMuted;
+}
+
+FVector FAccelByteVivoxFakeBackend::GetListenerPosition(const FString& ChannelName) const
+{
+	const FFakeChannel* Channel = Channels.Find(ChannelName);
+	return Channel != nullptr ? Channel->ListenerPosition : FVector::ZeroVector;
+}
+
+int32 FAccelByteVivoxFakeBackend::GetParticipantCount(const FString& ChannelName) const
+{
+	const FFakeChannel* Channel = Channels.Find(ChannelName);
+	return Channel != nullptr ? Channel->Participants.Num() : 0;
+}
+#endif
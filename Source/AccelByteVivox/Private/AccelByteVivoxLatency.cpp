@@ -0,0 +1,113 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteVivoxLatency.h"
+
+const TCHAR* LexToString(EAccelByteVivoxLatencyStage Stage)
+{
+	switch (Stage)
+	{
+	case EAccelByteVivoxLatencyStage::LoginToken:
+		return TEXT("LoginToken");
+	case EAccelByteVivoxLatencyStage::LoginSession:
+		return TEXT("LoginSession");
+	case EAccelByteVivoxLatencyStage::Login:
+		return TEXT("Login");
+	case EAccelByteVivoxLatencyStage::JoinToken:
+		return TEXT("JoinToken");
+	case EAccelByteVivoxLatencyStage::ChannelConnect:
+		return TEXT("ChannelConnect");
+	case EAccelByteVivoxLatencyStage::FirstParticipant:
+		return TEXT("FirstParticipant");
+	case EAccelByteVivoxLatencyStage::Join:
+		return TEXT("Join");
+	default:
+		return TEXT("Unknown");
+	}
+}
+
+FAccelByteVivoxLatencyHistogram::FAccelByteVivoxLatencyHistogram()
+{
+	Reset();
+}
+
+void FAccelByteVivoxLatencyHistogram::Add(double Seconds)
+{
+	Seconds = FMath::Max(Seconds, 0.0);
+
+	++Buckets[GetBucketIndex(Seconds)];
+	MinSeconds = Count == 0 ? Seconds : FMath::Min(MinSeconds, Seconds);
+	MaxSeconds = Count == 0 ? Seconds : FMath::Max(MaxSeconds, Seconds);
+	SumSeconds += Seconds;
+	++Count;
+}
+
+void FAccelByteVivoxLatencyHistogram::Reset()
+{
+	FMemory::Memzero(Buckets);
+	Count = 0;
+	SumSeconds = 0.0;
+	MinSeconds = 0.0;
+	MaxSeconds = 0.0;
+}
+
+double FAccelByteVivoxLatencyHistogram::GetPercentile(double Percentile) const
+{
+	if (Count == 0)
+	{
+		return 0.0;
+	}
+
+	const uint64 Rank = FMath::Clamp<uint64>(static_cast<uint64>(FMath::CeilToDouble(Percentile / 100.0 * Count)), 1, Count);
+	uint64 Seen = 0;
+	for (int32 Index = 0; Index < NumBuckets; ++Index)
+	{
+		Seen += Buckets[Index];
+		if (Seen >= Rank)
+		{
+			// The bucket bound may lie outside what was actually recorded, e.g. with a single sample
+			return FMath::Clamp(GetBucketUpperBound(Index), MinSeconds, MaxSeconds);
+		}
+	}
+	return MaxSeconds;
+}
+
+FAccelByteVivoxLatencySummary FAccelByteVivoxLatencyHistogram::GetSummary() const
+{
+	FAccelByteVivoxLatencySummary Summary;
+	Summary.Count = Count;
+	if (Count > 0)
+	{
+		Summary.MinSeconds = MinSeconds;
+		Summary.MeanSeconds = SumSeconds / Count;
+		Summary.P50Seconds = GetPercentile(50.0);
+		Summary.P95Seconds = GetPercentile(95.0);
+		Summary.P99Seconds = GetPercentile(99.0);
+		Summary.MaxSeconds = MaxSeconds;
+	}
+	return Summary;
+}
+
+int32 FAccelByteVivoxLatencyHistogram::GetBucketIndex(double Seconds)
+{
+	const double Milliseconds = Seconds * 1000.0;
+	if (Milliseconds < 1.0)
+	{
+		return 0;
+	}
+
+	const int32 Index = 1 + FMath::FloorToInt32(FMath::Log2(Milliseconds) * BucketsPerDoubling);
+	return FMath::Min(Index, NumBuckets - 1);
+}
+
+double FAccelByteVivoxLatencyHistogram::GetBucketUpperBound(int32 Index)
+{
+	if (Index == NumBuckets - 1)
+	{
+		return TNumericLimits<double>::Max();
+	}
+
+	// Bucket Index covers [2^((Index - 1) / 8), 2^(Index / 8)) milliseconds
+	return FMath::Pow(2.0, static_cast<double>(Index) / BucketsPerDoubling) / 1000.0;
+}
@@ -3,7 +3,9 @@
 // and restrictions contact your company contract manager.
 
 #include "AccelByteVivoxModule.h"
+#include "AccelByteVivoxSettings.h"
 #include "AccelByteVivoxVoiceChat.h"
+#include "Misc/CoreDelegates.h"
 
 IMPLEMENT_MODULE(FAccelByteVivoxModule, AccelByteVivox)
 
@@ -11,13 +13,32 @@ void FAccelByteVivoxModule::StartupModule()
 {
 	FAccelByteVivoxVoiceChatPtr VoiceChat = FAccelByteVivoxVoiceChat::Get();
 	VoiceChat->Initialize();
+
+	if (UAccelByteVivoxSettings::Get()->bDrainOnExit)
+	{
+		EnginePreExitHandle = FCoreDelegates::OnEnginePreExit.AddRaw(this, &FAccelByteVivoxModule::HandleEnginePreExit);
+	}
 }
 
 void FAccelByteVivoxModule::ShutdownModule()
 {
+	FCoreDelegates::OnEnginePreExit.Remove(EnginePreExitHandle);
+	EnginePreExitHandle.Reset();
+
 	FAccelByteVivoxVoiceChatPtr VoiceChat = FAccelByteVivoxVoiceChat::Get();
 	if (VoiceChat.IsValid())
 	{
+		// Nothing ticks any more, so whatever is left of the drain is waited out here
+		VoiceChat->FinishShutdown();
 		VoiceChat->Uninitialize();
 	}
 }
+
+void FAccelByteVivoxModule::HandleEnginePreExit()
+{
+	FAccelByteVivoxVoiceChatPtr VoiceChat = FAccelByteVivoxVoiceChat::Get();
+	if (VoiceChat.IsValid() && VoiceChat->IsInitialized() && !VoiceChat->IsShuttingDown())
+	{
+		VoiceChat->BeginShutdown();
+	}
+}
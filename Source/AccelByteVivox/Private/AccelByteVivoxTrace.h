@@ -0,0 +1,46 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+#if UE_TRACE_ENABLED && CPUPROFILERTRACE_ENABLED && !UE_BUILD_SHIPPING
+#define ACCELBYTEVIVOX_TRACE_ENABLED 1
+#else
+#define ACCELBYTEVIVOX_TRACE_ENABLED 0
+#endif
+
+#if ACCELBYTEVIVOX_TRACE_ENABLED
+
+// Enable with -trace=default,counters,AccelByteVivox or "Trace.Enable AccelByteVivox"
+UE_TRACE_CHANNEL_EXTERN(AccelByteVivoxChannel)
+
+#define ACCELBYTEVIVOX_TRACE_IS_ENABLED() UE_TRACE_CHANNELEXPR_IS_ENABLED(AccelByteVivoxChannel)
+
+// Scoped CPU event named AccelByteVivox::<Name>
+#define ACCELBYTEVIVOX_TRACE_SCOPE(Name) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("AccelByteVivox::" #Name, AccelByteVivoxChannel)
+
+// Timeline marker, only formatted while the channel is enabled
+#define ACCELBYTEVIVOX_TRACE_BOOKMARK(Format, ...) \
+	do \
+	{ \
+		if (ACCELBYTEVIVOX_TRACE_IS_ENABLED()) \
+		{ \
+			TRACE_BOOKMARK(Format, ##__VA_ARGS__); \
+		} \
+	} while (0)
+
+#else
+
+#define ACCELBYTEVIVOX_TRACE_IS_ENABLED() false
+#define ACCELBYTEVIVOX_TRACE_SCOPE(Name)
+#define ACCELBYTEVIVOX_TRACE_BOOKMARK(Format, ...) do {} while (0)
+
+#endif
@@ -4,17 +4,92 @@
 
 #include "AccelByteVivoxVoiceChat.h"
 #include "AccelByteVivoxSettings.h"
+#include "AccelByteVivoxCoreBackend.h"
+#include "AccelByteVivoxFakeBackend.h"
+#include "AccelByteVivoxTrace.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
-#if VIVOX_AVAILABLE
-#include "VivoxCore.h"
+DEFINE_LOG_CATEGORY(LogAccelByteVivox);
+
+#if ACCELBYTEVIVOX_TRACE_ENABLED
+UE_TRACE_CHANNEL_DEFINE(AccelByteVivoxChannel)
+TRACE_DECLARE_INT_COUNTER(AccelByteVivoxChannels, TEXT("AccelByteVivox/Channels"));
+TRACE_DECLARE_INT_COUNTER(AccelByteVivoxParticipants, TEXT("AccelByteVivox/Participants"));
 #endif
 
-#include "Api/AccelByteVivoxAuthApi.h"
-#include "Models/AccelByteVivoxAuthModels.h"
+static FAccelByteVivoxVoiceChatPtr AccelByteVivoxInstance = nullptr;
 
-DEFINE_LOG_CATEGORY(LogAccelByteVivox);
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+static constexpr bool NoShrinking = false;
+#else
+static constexpr EAllowShrinking NoShrinking = EAllowShrinking::No;
+#endif
 
-static FAccelByteVivoxVoiceChatPtr AccelByteVivoxInstance = nullptr;
+// Most strings spare participant buffers are kept for; enough for a few hundred participants leaving and rejoining
+static constexpr int32 MaxSpareParticipantStrings = 2048;
+
+// Copies Source into the buffer of a spare string, if there is one, rather than into a new allocation
+static FString TakeSpareString(TArray<FString>& SpareStrings, const FString& Source)
+{
+	if (SpareStrings.Num() == 0 || Source.IsEmpty())
+	{
+		return Source;
+	}
+
+	FString Result = SpareStrings.Pop(NoShrinking);
+	Result.Reset();
+	Result.Append(Source);
+	return Result;
+}
+
+static void ReturnSpareString(TArray<FString>& SpareStrings, FString&& String)
+{
+	if (SpareStrings.Num() < MaxSpareParticipantStrings && String.GetAllocatedSize() > 0)
+	{
+		SpareStrings.Add(MoveTemp(String));
+	}
+}
+
+// Removes the entry for Key and keeps the buffer of its stored key. The set unlinks an entry through its hash index, so the
+// key may be moved out first.
+template <typename MapType>
+static void RemoveKeepingKey(MapType& Map, const FString& Key, TArray<FString>& SpareStrings)
+{
+	const FSetElementId ElementId = Map.FindId(Key);
+	if (!ElementId.IsValidId())
+	{
+		return;
+	}
+
+	ReturnSpareString(SpareStrings, MoveTemp(Map.Get(ElementId).Key));
+	Map.Remove(ElementId);
+}
+
+static constexpr uint32 BlockListFileMagic = 0x4C424156; // "VABL"
+static constexpr uint32 BlockListFileVersion = 1;
+
+// How often FinishShutdown polls the backend while it waits
+static constexpr float ShutdownPumpIntervalSeconds = 0.005f;
+
+static FAccelByteVivoxBackendPtr CreateDefaultBackend()
+{
+#if !UE_BUILD_SHIPPING
+	if (UAccelByteVivoxSettings::Get()->bUseFakeBackend)
+	{
+		return MakeShared<FAccelByteVivoxFakeBackend, ESPMode::ThreadSafe>();
+	}
+#endif
+
+#if VIVOX_AVAILABLE
+	return MakeShared<FAccelByteVivoxCoreBackend, ESPMode::ThreadSafe>();
+#else
+	return nullptr;
+#endif
+}
 
 FAccelByteVivoxVoiceChatPtr FAccelByteVivoxVoiceChat::Get()
 {
@@ -36,608 +111,3362 @@ FAccelByteVivoxVoiceChat::~FAccelByteVivoxVoiceChat()
 
 void FAccelByteVivoxVoiceChat::Initialize()
 {
-#if VIVOX_AVAILABLE
-	if (VivoxVoiceClient != nullptr)
+	if (bInitialized)
 	{
 		UE_LOG(LogAccelByteVivox, Warning, TEXT("Vivox already initialized"));
 		return;
 	}
 
-	FVivoxCoreModule* VivoxModule = static_cast<FVivoxCoreModule*>(
-		&FModuleManager::Get().LoadModuleChecked(TEXT("VivoxCore")));
-
-	if (VivoxModule == nullptr)
+	if (!Backend.IsValid())
 	{
-		UE_LOG(LogAccelByteVivox, Error, TEXT("Failed to load VivoxCore module"));
-		return;
+		Backend = CreateDefaultBackend();
 	}
 
-	VivoxVoiceClient = &VivoxModule->VoiceClient();
-	VivoxCoreError Error = VivoxVoiceClient->Initialize();
-	if (Error != VxErrorSuccess)
+	if (!Backend.IsValid())
 	{
-		UE_LOG(LogAccelByteVivox, Error, TEXT("Failed to initialize Vivox client, error: %d"), static_cast<int32>(Error));
-		VivoxVoiceClient = nullptr;
+		UE_LOG(LogAccelByteVivox, Log, TEXT("Vivox not available on this platform"));
 		return;
 	}
 
-	UE_LOG(LogAccelByteVivox, Log, TEXT("Vivox initialized successfully"));
-#else
-	UE_LOG(LogAccelByteVivox, Log, TEXT("Vivox not available on this platform"));
-#endif
-}
+	// Sized before the backend can raise anything, since the ring cannot be resized under its producers
+	RosterEventQueue.Initialize(UAccelByteVivoxSettings::Get()->RosterEventQueueCapacity);
 
-void FAccelByteVivoxVoiceChat::Uninitialize()
-{
-#if VIVOX_AVAILABLE
-	if (VivoxVoiceClient == nullptr)
+	const int32 Error = Backend->Initialize(this);
+	if (Error != IAccelByteVivoxBackend::Success)
 	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("Failed to initialize Vivox client, error: %d"), Error);
 		return;
 	}
 
-	if (CurrentLoginState != EVivoxLoginState::NotLoggedIn)
+	bInitialized = true;
+	SyncBlockedPlayersToBackend();
+	bCoalesceTalkingEvents = UAccelByteVivoxSettings::Get()->bCoalesceTalkingEvents;
+	MaxConcurrentChannels = UAccelByteVivoxSettings::Get()->MaxConcurrentChannels;
+	if (UAccelByteVivoxSettings::Get()->bPersistBlockList)
 	{
-		LeaveAllChannels();
-		Logout();
+		LoadBlockList();
 	}
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FAccelByteVivoxVoiceChat::Tick));
 
-	VivoxVoiceClient->Uninitialize();
-	VivoxVoiceClient = nullptr;
-
-	UE_LOG(LogAccelByteVivox, Log, TEXT("Vivox uninitialized"));
-#endif
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Vivox initialized successfully (backend: %s)"), Backend->GetName());
 }
 
-void FAccelByteVivoxVoiceChat::Login(const AccelByte::FApiClientPtr& ApiClient, const FString& InUsername)
+void FAccelByteVivoxVoiceChat::Uninitialize()
 {
-#if VIVOX_AVAILABLE
-	if (VivoxVoiceClient == nullptr)
+	if (!bInitialized)
 	{
-		UE_LOG(LogAccelByteVivox, Error, TEXT("Login failed: Vivox not initialized. Call Initialize() first"));
-		OnLoginCompleted.Broadcast(false);
 		return;
 	}
 
-	if (CurrentLoginState != EVivoxLoginState::NotLoggedIn)
+	if (PendingShutdown.bActive)
 	{
-		UE_LOG(LogAccelByteVivox, Warning, TEXT("Login failed: Already logged in or login in progress"));
-		OnLoginCompleted.Broadcast(false);
+		// Forces the teardown and reports the shutdown as not drained; comes back here to do it
+		CompleteShutdown(false);
 		return;
 	}
 
-	if (!ApiClient.IsValid())
+	CancelReconnect();
+	if (CurrentLoginState != EVivoxLoginState::NotLoggedIn)
 	{
-		UE_LOG(LogAccelByteVivox, Error, TEXT("Login failed: Invalid ApiClient"));
-		OnLoginCompleted.Broadcast(false);
-		return;
+		LeaveAllChannels();
+		Logout();
 	}
 
-	ApiClientPtr = ApiClient;
-	Username = InUsername;
-	CurrentLoginState = EVivoxLoginState::LoggingIn;
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
 
-	const UAccelByteVivoxSettings* Settings = UAccelByteVivoxSettings::Get();
-	VivoxAccountId = AccountId(Settings->VivoxIssuer, Username, Settings->VivoxDomain);
-	VivoxLoginSession = &VivoxVoiceClient->GetLoginSession(VivoxAccountId);
+	Backend->Uninitialize();
+	bInitialized = false;
 
-	// Request login token from AccelByte
-	AccelByte::Api::VivoxAuth VivoxAuthApi = ApiClientPtr->GetApi<AccelByte::Api::VivoxAuth>();
+	// Everything still queued refers to sessions that no longer exist
+	LoginToken = FLoginToken();
+	ControlEventQueue.Empty();
+	RosterEventQueue.Empty();
+	QueuedControlEventCount = 0;
+	QueuedRosterEventCount = 0;
 
-	FAccelByteVivoxAuthServiceGenerateVivoxTokenRequest Request;
-	Request.Type = EAccelByteVivoxAuthServiceGenerateVivoxTokenRequestType::login;
-	Request.Username = Username;
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Vivox uninitialized"));
+}
 
-	VivoxAuthApi.ServiceGenerateVivoxToken(
-		Request,
-		THandler<FAccelByteVivoxAuthServiceGenerateVivoxTokenResponse>::CreateLambda(
-			[this](const FAccelByteVivoxAuthServiceGenerateVivoxTokenResponse& Response)
-			{
-				HandleLoginTokenResponse(Response.AccessToken, Response.Uri);
-			}),
-		FErrorHandler::CreateLambda([this](int32 ErrorCode, const FString& ErrorMessage)
-		{
-			UE_LOG(LogAccelByteVivox, Error, TEXT("Failed to get login token. Code: %d, Message: %s"), ErrorCode, *ErrorMessage);
-			CurrentLoginState = EVivoxLoginState::NotLoggedIn;
-			OnLoginCompleted.Broadcast(false);
-		})
-	);
-#else
-	UE_LOG(LogAccelByteVivox, Warning, TEXT("Login: Vivox not available on this platform"));
-	OnLoginCompleted.Broadcast(false);
-#endif
+bool FAccelByteVivoxVoiceChat::IsInitialized() const
+{
+	return bInitialized;
 }
 
-#if VIVOX_AVAILABLE
-void FAccelByteVivoxVoiceChat::HandleLoginTokenResponse(const FString& AccessToken, const FString& Uri)
+void FAccelByteVivoxVoiceChat::BeginShutdown(const FOnVivoxShutdownCompleted& OnCompleted)
 {
-	if (VivoxLoginSession == nullptr)
+	ACCELBYTEVIVOX_TRACE_SCOPE(BeginShutdown);
+	if (!bInitialized)
 	{
-		UE_LOG(LogAccelByteVivox, Error, TEXT("Login session is null after token received"));
-		CurrentLoginState = EVivoxLoginState::NotLoggedIn;
-		OnLoginCompleted.Broadcast(false);
+		OnCompleted.ExecuteIfBound(true);
 		return;
 	}
 
-	const UAccelByteVivoxSettings* Settings = UAccelByteVivoxSettings::Get();
-	const FString LoginServerUri = Settings->VivoxServer;
-	if (LoginServerUri.IsEmpty())
+	if (PendingShutdown.bActive)
 	{
-		UE_LOG(LogAccelByteVivox, Error, TEXT("Vivox login failed: server URI missing. Set VivoxServer in AccelByteVivox settings."));
-		CurrentLoginState = EVivoxLoginState::NotLoggedIn;
-		OnLoginCompleted.Broadcast(false);
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("BeginShutdown: Shutdown already in progress"));
 		return;
 	}
 
-	VivoxCoreError Error = VivoxLoginSession->BeginLogin(
-		LoginServerUri,
-		AccessToken,
-		ILoginSession::FOnBeginLoginCompletedDelegate::CreateRaw(
-			this, &FAccelByteVivoxVoiceChat::HandleVivoxLoginCompleted));
+	const double Now = FPlatformTime::Seconds();
+	PendingShutdown.bActive = true;
+	PendingShutdown.StartedAt = Now;
+	PendingShutdown.Deadline = Now + UAccelByteVivoxSettings::Get()->ShutdownDrainTimeoutSeconds;
+	PendingShutdown.OnCompleted = OnCompleted;
+	CancelReconnect();
 
-	if (Error != VxErrorSuccess)
+	// All disconnects go out together, and each channel is cleaned up by HandleChannelDisconnected as it is confirmed
+	for (TPair<FAccelByteVivoxChannelHandle, FChannelState>& Pair : Channels)
 	{
-		UE_LOG(LogAccelByteVivox, Error, TEXT("BeginLogin failed with error: %d"), static_cast<int32>(Error));
-		CurrentLoginState = EVivoxLoginState::NotLoggedIn;
-		OnLoginCompleted.Broadcast(false);
+		Pair.Value.bLeaveRequested = true;
+		Backend->Disconnect(Pair.Key);
 	}
-}
 
-void FAccelByteVivoxVoiceChat::HandleVivoxLoginCompleted(VivoxCoreError Error)
-{
-	if (Error == VxErrorSuccess)
-	{
-		CurrentLoginState = EVivoxLoginState::LoggedIn;
-
-		LoginSessionStateChangedHandle = VivoxLoginSession->EventStateChanged.AddRaw(
-			this, &FAccelByteVivoxVoiceChat::HandleLoginSessionStateChanged);
-
-		UE_LOG(LogAccelByteVivox, Log, TEXT("Vivox login successful for user: %s"), *Username);
-		OnLoginCompleted.Broadcast(true);
-	}
-	else
+	TArray<FString> WaitingChannelNames;
+	PendingJoins.GetKeys(WaitingChannelNames);
+	for (const FString& ChannelName : WaitingChannelNames)
 	{
-		UE_LOG(LogAccelByteVivox, Error, TEXT("Vivox login failed with error: %d"), static_cast<int32>(Error));
-		CurrentLoginState = EVivoxLoginState::NotLoggedIn;
-		OnLoginCompleted.Broadcast(false);
+		CancelJoinBeforeConnect(ChannelName);
 	}
+
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Shutting down: waiting on %d channel disconnects for up to %.2fs"),
+		Channels.Num(), PendingShutdown.Deadline - Now);
+	ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Shutdown started"));
 }
 
-void FAccelByteVivoxVoiceChat::HandleLoginSessionStateChanged(LoginState State)
+bool FAccelByteVivoxVoiceChat::IsShuttingDown() const
 {
-	if (State == LoginState::LoggedOut)
-	{
-		UE_LOG(LogAccelByteVivox, Log, TEXT("Vivox login session logged out"));
-		CurrentLoginState = EVivoxLoginState::NotLoggedIn;
-		VivoxLoginSession = nullptr;
-		OnLogoutCompleted.Broadcast();
-	}
+	return PendingShutdown.bActive;
 }
-#endif
 
-void FAccelByteVivoxVoiceChat::Logout()
+void FAccelByteVivoxVoiceChat::FinishShutdown()
 {
-#if VIVOX_AVAILABLE
-	if (VivoxLoginSession == nullptr || CurrentLoginState == EVivoxLoginState::NotLoggedIn)
-	{
-		UE_LOG(LogAccelByteVivox, Warning, TEXT("Logout: Not logged in"));
-		return;
-	}
-
-	LeaveAllChannels();
-
-	if (LoginSessionStateChangedHandle.IsValid())
+	ACCELBYTEVIVOX_TRACE_SCOPE(FinishShutdown);
+	// The deadline set by BeginShutdown still applies, so this waits at most ShutdownDrainTimeoutSeconds in all
+	while (PendingShutdown.bActive)
 	{
-		VivoxLoginSession->EventStateChanged.Remove(LoginSessionStateChangedHandle);
-		LoginSessionStateChangedHandle.Reset();
+		Backend->Tick(ShutdownPumpIntervalSeconds);
+		ProcessQueuedEvents();
+		UpdateShutdown();
+		if (PendingShutdown.bActive)
+		{
+			FPlatformProcess::Sleep(ShutdownPumpIntervalSeconds);
+		}
 	}
-
-	VivoxLoginSession->Logout();
-	VivoxLoginSession = nullptr;
-	CurrentLoginState = EVivoxLoginState::NotLoggedIn;
-	ApiClientPtr.Reset();
-
-	UE_LOG(LogAccelByteVivox, Log, TEXT("Vivox logged out"));
-	OnLogoutCompleted.Broadcast();
-#endif
-}
-
-bool FAccelByteVivoxVoiceChat::IsLoggedIn() const
-{
-	return CurrentLoginState == EVivoxLoginState::LoggedIn;
 }
 
-void FAccelByteVivoxVoiceChat::JoinChannel(const FString& ChannelName)
+void FAccelByteVivoxVoiceChat::UpdateShutdown()
 {
-#if VIVOX_AVAILABLE
-	if (CurrentLoginState != EVivoxLoginState::LoggedIn)
+	if (!PendingShutdown.bActive)
 	{
-		UE_LOG(LogAccelByteVivox, Error, TEXT("JoinChannel failed: Not logged in"));
-		OnChannelJoined.Broadcast(ChannelName, false);
 		return;
 	}
 
-	if (ChannelSessions.Contains(ChannelName))
+	if (Channels.Num() == 0)
 	{
-		UE_LOG(LogAccelByteVivox, Warning, TEXT("JoinChannel: Already in channel %s"), *ChannelName);
-		OnChannelJoined.Broadcast(ChannelName, true);
-		return;
+		CompleteShutdown(true);
 	}
-
-	if (!ApiClientPtr.IsValid())
+	else if (FPlatformTime::Seconds() >= PendingShutdown.Deadline)
 	{
-		UE_LOG(LogAccelByteVivox, Error, TEXT("JoinChannel failed: ApiClient is invalid"));
-		OnChannelJoined.Broadcast(ChannelName, false);
-		return;
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("Shutdown: %d channel disconnects not confirmed by the deadline, tearing down anyway"),
+			Channels.Num());
+		CompleteShutdown(false);
 	}
+}
 
-	// Request join token from AccelByte
-	AccelByte::Api::VivoxAuth VivoxAuthApi = ApiClientPtr->GetApi<AccelByte::Api::VivoxAuth>();
+void FAccelByteVivoxVoiceChat::CompleteShutdown(bool bDrained)
+{
+	const FOnVivoxShutdownCompleted OnCompleted = MoveTemp(PendingShutdown.OnCompleted);
+	const double ShutdownSeconds = FPlatformTime::Seconds() - PendingShutdown.StartedAt;
+	PendingShutdown = FPendingShutdown();
 
-	FAccelByteVivoxAuthServiceGenerateVivoxTokenRequest Request;
-	Request.Type = EAccelByteVivoxAuthServiceGenerateVivoxTokenRequestType::join;
-	Request.Username = Username;
-	Request.ChannelId = ChannelName;
-	Request.ChannelType = EAccelByteVivoxAuthServiceGenerateVivoxTokenRequestChannelType::nonpositional;
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Shutdown %s after %.3fs"), bDrained ? TEXT("drained") : TEXT("forced"), ShutdownSeconds);
+	ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Shutdown %s"), bDrained ? TEXT("drained") : TEXT("forced"));
 
-	VivoxAuthApi.ServiceGenerateVivoxToken(
-		Request,
-		THandler<FAccelByteVivoxAuthServiceGenerateVivoxTokenResponse>::CreateLambda(
-			[this, ChannelName](const FAccelByteVivoxAuthServiceGenerateVivoxTokenResponse& Response)
-			{
-				HandleJoinTokenResponse(ChannelName, Response.AccessToken, Response.Uri);
-			}),
-		FErrorHandler::CreateLambda([this, ChannelName](int32 ErrorCode, const FString& ErrorMessage)
-		{
-			UE_LOG(LogAccelByteVivox, Error, TEXT("Failed to get join token for channel %s. Code: %d, Message: %s"),
-				*ChannelName, ErrorCode, *ErrorMessage);
-			OnChannelJoined.Broadcast(ChannelName, false);
-		})
-	);
-#else
-	UE_LOG(LogAccelByteVivox, Warning, TEXT("JoinChannel: Vivox not available on this platform"));
-	OnChannelJoined.Broadcast(ChannelName, false);
-#endif
+	// Whatever is left of the channels is released without waiting, then the login session and the client go
+	Uninitialize();
+	OnCompleted.ExecuteIfBound(bDrained);
 }
 
-#if VIVOX_AVAILABLE
-void FAccelByteVivoxVoiceChat::HandleJoinTokenResponse(const FString& ChannelName, const FString& AccessToken, const FString& Uri)
+void FAccelByteVivoxVoiceChat::SetBackend(const FAccelByteVivoxBackendPtr& InBackend)
 {
-	if (VivoxLoginSession == nullptr)
-	{
-		UE_LOG(LogAccelByteVivox, Error, TEXT("Join channel failed: Login session is null"));
-		OnChannelJoined.Broadcast(ChannelName, false);
-		return;
-	}
-
-	if (Uri.IsEmpty())
+	if (bInitialized)
 	{
-		UE_LOG(LogAccelByteVivox, Error, TEXT("Join channel failed: server URI missing in token response."));
-		OnChannelJoined.Broadcast(ChannelName, false);
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetBackend: Call Uninitialize() before replacing the backend"));
 		return;
 	}
 
-	const UAccelByteVivoxSettings* Settings = UAccelByteVivoxSettings::Get();
-	ChannelId VivoxChannelId(Settings->VivoxIssuer, ChannelName, Settings->VivoxDomain, ChannelType::NonPositional);
-
-	IChannelSession& ChannelSession = VivoxLoginSession->GetChannelSession(VivoxChannelId);
-
-	// Register participant event handlers
-	ChannelSession.EventAfterParticipantAdded.AddRaw(
-		this, &FAccelByteVivoxVoiceChat::HandleParticipantAdded);
-	ChannelSession.EventBeforeParticipantRemoved.AddRaw(
-		this, &FAccelByteVivoxVoiceChat::HandleParticipantRemoved);
-	ChannelSession.EventAfterParticipantUpdated.AddRaw(
-		this, &FAccelByteVivoxVoiceChat::HandleParticipantUpdated);
+	Backend = InBackend;
+	// A prefetched token belongs to the backend that requested it
+	LoginToken = FLoginToken();
+}
 
-	ChannelSessions.Add(ChannelName, &ChannelSession);
+FAccelByteVivoxBackendPtr FAccelByteVivoxVoiceChat::GetBackend() const
+{
+	return Backend;
+}
 
-	VivoxCoreError Error = ChannelSession.BeginConnect(
-		true,  // audio
-		false, // text
-		false, // switchTransmission — caller controls via SetTransmissionChannel()
-		AccessToken,
-		IChannelSession::FOnBeginConnectCompletedDelegate::CreateLambda(
-			[this, ChannelName](VivoxCoreError ConnectError)
-			{
-				HandleChannelConnectCompleted(ChannelName, ConnectError);
-			}));
+FAccelByteVivoxEventQueueStats FAccelByteVivoxVoiceChat::GetEventQueueStats() const
+{
+	FAccelByteVivoxEventQueueStats Stats = EventQueueStats;
+	Stats.PendingRoster = QueuedRosterEventCount;
+	Stats.Pending = QueuedControlEventCount + Stats.PendingRoster;
+	Stats.RosterCapacity = RosterEventQueue.GetCapacity();
+	Stats.RosterUpdatesDropped = DroppedRosterUpdateCount.load(std::memory_order_relaxed);
+	Stats.RosterMembershipDropped = DroppedRosterMembershipCount.load(std::memory_order_relaxed);
+	return Stats;
+}
 
-	if (Error != VxErrorSuccess)
-	{
-		UE_LOG(LogAccelByteVivox, Error, TEXT("BeginConnect failed for channel %s, error: %d"),
-			*ChannelName, static_cast<int32>(Error));
-		CleanUpChannelSession(ChannelName);
-		OnChannelJoined.Broadcast(ChannelName, false);
-	}
+void FAccelByteVivoxVoiceChat::EnqueueEvent(FQueuedEvent&& Event)
+{
+	ControlEventQueue.Enqueue(MoveTemp(Event));
+	++QueuedControlEventCount;
 }
 
-void FAccelByteVivoxVoiceChat::HandleChannelConnectCompleted(const FString& ChannelName, VivoxCoreError Error)
+void FAccelByteVivoxVoiceChat::EnqueueRosterEvent(ERosterEventType Type, FAccelByteVivoxChannelHandle Channel,
+	FAccelByteVivoxParticipantHandle Participant, bool bValue, float AudioEnergy)
 {
-	if (Error == VxErrorSuccess)
+	FRosterEvent Event;
+	Event.Type = Type;
+	Event.bValue = bValue;
+	Event.AudioEnergy = AudioEnergy;
+	Event.Channel = Channel;
+	Event.Participant = Participant;
+
+	// Speech updates leave the last quarter of the ring to adds and removes. A dropped update only delays a talking
+	// change until the next one; a dropped add or remove leaves the roster wrong, and is reported from the game thread.
+	const bool bUpdate = Type == ERosterEventType::ParticipantUpdated;
+	if (RosterEventQueue.Enqueue(Event, bUpdate ? RosterEventQueue.GetCapacity() / 4 : 0))
 	{
-		IChannelSession** ChannelSessionPtr = ChannelSessions.Find(ChannelName);
-		if (ChannelSessionPtr != nullptr && *ChannelSessionPtr != nullptr)
-		{
-			FDelegateHandle Handle = (*ChannelSessionPtr)->EventChannelStateChanged.AddLambda(
-				[this, ChannelName](const IChannelConnectionState& State)
-				{
-					HandleChannelStateChanged(ChannelName, State);
-				});
-			ChannelStateChangedHandles.Add(ChannelName, Handle);
-		}
-
-		UE_LOG(LogAccelByteVivox, Log, TEXT("Joined channel: %s"), *ChannelName);
-		OnChannelJoined.Broadcast(ChannelName, true);
+		++QueuedRosterEventCount;
+	}
+	else if (bUpdate)
+	{
+		DroppedRosterUpdateCount.fetch_add(1, std::memory_order_relaxed);
 	}
 	else
 	{
-		UE_LOG(LogAccelByteVivox, Error, TEXT("Failed to join channel %s, error: %d"),
-			*ChannelName, static_cast<int32>(Error));
-		CleanUpChannelSession(ChannelName);
-		OnChannelJoined.Broadcast(ChannelName, false);
+		DroppedRosterMembershipCount.fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-void FAccelByteVivoxVoiceChat::HandleChannelStateChanged(const FString& ChannelName, const IChannelConnectionState& State)
+void FAccelByteVivoxVoiceChat::ProcessQueuedEvents()
 {
-	if (State.State() == ConnectionState::Disconnected)
+	ACCELBYTEVIVOX_TRACE_SCOPE(ProcessQueuedEvents);
+	const double StartTime = FPlatformTime::Seconds();
+	EventQueueStats.PeakPending = FMath::Max(EventQueueStats.PeakPending, QueuedControlEventCount + QueuedRosterEventCount);
+
+	// Events queued while processing, e.g. by a delegate that calls back into the backend, wait for the next tick
+	int32 ControlEventsToProcess = QueuedControlEventCount;
+	FQueuedEvent Event;
+	while (ControlEventsToProcess-- > 0 && ControlEventQueue.Dequeue(Event))
 	{
-		UE_LOG(LogAccelByteVivox, Log, TEXT("Channel %s disconnected"), *ChannelName);
-		CleanUpChannelSession(ChannelName);
-		OnChannelLeft.Broadcast(ChannelName);
+		--QueuedControlEventCount;
+		++EventQueueStats.Processed;
+		ProcessEvent(Event);
 	}
-}
 
-void FAccelByteVivoxVoiceChat::CleanUpChannelSession(const FString& ChannelName)
-{
-	FDelegateHandle* StateHandle = ChannelStateChangedHandles.Find(ChannelName);
-	if (StateHandle != nullptr)
+	const float BudgetMs = UAccelByteVivoxSettings::Get()->EventProcessingBudgetMs;
+	const double Deadline = StartTime + BudgetMs / 1000.0;
+
+	int32 RosterEventsToProcess = QueuedRosterEventCount;
+	int32 RosterEventsProcessed = 0;
+	FRosterEvent RosterEvent;
+	while (RosterEventsToProcess-- > 0)
 	{
-		IChannelSession** ChannelSessionPtr = ChannelSessions.Find(ChannelName);
-		if (ChannelSessionPtr != nullptr && *ChannelSessionPtr != nullptr)
+		// At least one event per tick, so even a budget used up by the control lane still makes progress
+		if (BudgetMs > 0.0f && RosterEventsProcessed > 0 && FPlatformTime::Seconds() >= Deadline)
+		{
+			++EventQueueStats.BudgetExhaustedTicks;
+			break;
+		}
+
+		if (!RosterEventQueue.Dequeue(RosterEvent))
 		{
-			(*ChannelSessionPtr)->EventChannelStateChanged.Remove(*StateHandle);
+			break;
 		}
-		ChannelStateChangedHandles.Remove(ChannelName);
+
+		--QueuedRosterEventCount;
+		++EventQueueStats.Processed;
+		++RosterEventsProcessed;
+		ProcessRosterEvent(RosterEvent);
 	}
 
-	IChannelSession** ChannelSessionPtr = ChannelSessions.Find(ChannelName);
-	if (ChannelSessionPtr != nullptr && *ChannelSessionPtr != nullptr && VivoxLoginSession != nullptr)
+	const uint64 DroppedMembership = DroppedRosterMembershipCount.load(std::memory_order_relaxed);
+	if (DroppedMembership != ReportedRosterMembershipDrops)
 	{
-		VivoxLoginSession->DeleteChannelSession((*ChannelSessionPtr)->Channel());
+		UE_LOG(LogAccelByteVivox, Error, TEXT("Participant event queue full: %llu participant adds or removes dropped, rosters may be wrong. Raise RosterEventQueueCapacity (%d)."),
+			DroppedMembership - ReportedRosterMembershipDrops, RosterEventQueue.GetCapacity());
+		ReportedRosterMembershipDrops = DroppedMembership;
 	}
-
-	ChannelSessions.Remove(ChannelName);
-	ParticipantTalkingState.Remove(ChannelName);
 }
-#endif
 
-void FAccelByteVivoxVoiceChat::LeaveChannel(const FString& ChannelName)
+void FAccelByteVivoxVoiceChat::ProcessEvent(FQueuedEvent& Event)
 {
-#if VIVOX_AVAILABLE
-	IChannelSession** ChannelSessionPtr = ChannelSessions.Find(ChannelName);
-	if (ChannelSessionPtr == nullptr || *ChannelSessionPtr == nullptr)
+	switch (Event.Type)
 	{
-		UE_LOG(LogAccelByteVivox, Warning, TEXT("LeaveChannel: Not in channel %s"), *ChannelName);
-		return;
+	case EQueuedEventType::LoginTokenReceived:
+		if (Event.RequestId == LoginToken.RequestId)
+		{
+			HandleLoginTokenReceived(Event.AccessToken, Event.Uri);
+		}
+		break;
+	case EQueuedEventType::LoginTokenFailed:
+		if (Event.RequestId == LoginToken.RequestId)
+		{
+			HandleLoginTokenFailed(Event.Error, Event.ErrorMessage);
+		}
+		break;
+	case EQueuedEventType::LoginCompleted:
+		if (Event.RequestId == LoginAttempt)
+		{
+			HandleVivoxLoginCompleted(Event.Error);
+		}
+		break;
+	case EQueuedEventType::LoggedOut:
+		HandleLoggedOut();
+		break;
+	case EQueuedEventType::JoinTokenReceived:
+		HandleJoinTokenReceived(Event.ChannelName, Event.RequestId, Event.AccessToken, Event.Uri);
+		break;
+	case EQueuedEventType::JoinTokenFailed:
+		HandleJoinTokenFailed(Event.ChannelName, Event.RequestId, Event.Error, Event.ErrorMessage);
+		break;
+	case EQueuedEventType::ChannelConnectCompleted:
+		HandleChannelConnectCompleted(Event.Channel, Event.ChannelName, Event.Error);
+		break;
+	case EQueuedEventType::ChannelDisconnected:
+		HandleChannelDisconnected(Event.Channel);
+		break;
+	case EQueuedEventType::ParticipantMuteCompleted:
+		HandleParticipantMuteCompleted(Event.Channel, Event.Participant, Event.ParticipantId, Event.bValue, Event.Error, Event.RequestId);
+		break;
 	}
-
-	(*ChannelSessionPtr)->Disconnect();
-	UE_LOG(LogAccelByteVivox, Log, TEXT("Leaving channel: %s"), *ChannelName);
-	// Cleanup will happen in HandleChannelStateChanged when disconnect completes
-#endif
 }
 
-void FAccelByteVivoxVoiceChat::LeaveAllChannels()
+void FAccelByteVivoxVoiceChat::ProcessRosterEvent(const FRosterEvent& Event)
 {
-#if VIVOX_AVAILABLE
-	TArray<FString> ChannelNames;
-	ChannelSessions.GetKeys(ChannelNames);
-
-	for (const FString& ChannelName : ChannelNames)
+	switch (Event.Type)
 	{
-		IChannelSession** ChannelSessionPtr = ChannelSessions.Find(ChannelName);
-		if (ChannelSessionPtr != nullptr && *ChannelSessionPtr != nullptr)
-		{
-			(*ChannelSessionPtr)->Disconnect();
-		}
+	case ERosterEventType::ParticipantAdded:
+		HandleParticipantAdded(Event.Channel, Event.Participant, Event.bValue);
+		break;
+	case ERosterEventType::ParticipantRemoved:
+		HandleParticipantRemoved(Event.Channel, Event.Participant);
+		break;
+	case ERosterEventType::ParticipantUpdated:
+		HandleParticipantUpdated(Event.Channel, Event.Participant, Event.bValue, Event.AudioEnergy);
+		break;
 	}
-
-	// Force cleanup in case disconnect callbacks don't fire (e.g., during shutdown)
-	ChannelSessions.Empty();
-	ChannelStateChangedHandles.Empty();
-	ParticipantTalkingState.Empty();
-#endif
 }
 
-bool FAccelByteVivoxVoiceChat::IsInChannel(const FString& ChannelName) const
+bool FAccelByteVivoxVoiceChat::Tick(float DeltaTime)
 {
-#if VIVOX_AVAILABLE
-	return ChannelSessions.Contains(ChannelName);
-#else
-	return false;
-#endif
+	ACCELBYTEVIVOX_TRACE_SCOPE(Tick);
+	Backend->Tick(DeltaTime);
+	ProcessQueuedEvents();
+	UpdateReconnect();
+	UpdateChannelSwitches();
+	UpdatePositions();
+	ApplyElapsedTalkingHolds();
+	FlushTalkingChanges();
+	SampleAudioEnergy();
+	TraceCounters();
+	// Last, since a shutdown that finishes here uninitializes
+	UpdateShutdown();
+	return true;
 }
 
-void FAccelByteVivoxVoiceChat::SetTransmissionChannel(const FString& ChannelName)
+void FAccelByteVivoxVoiceChat::TraceCounters() const
 {
-#if VIVOX_AVAILABLE
-	if (VivoxLoginSession == nullptr)
+#if ACCELBYTEVIVOX_TRACE_ENABLED
+	if (!ACCELBYTEVIVOX_TRACE_IS_ENABLED())
 	{
-		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetTransmissionChannel: Not logged in"));
 		return;
 	}
 
-	IChannelSession** ChannelSessionPtr = ChannelSessions.Find(ChannelName);
-	if (ChannelSessionPtr == nullptr || *ChannelSessionPtr == nullptr)
+	int64 ParticipantCount = 0;
+	for (const TPair<FAccelByteVivoxChannelHandle, FChannelState>& Pair : Channels)
 	{
-		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetTransmissionChannel: Not in channel %s"), *ChannelName);
-		return;
+		ParticipantCount += Pair.Value.Num();
 	}
-
-	VivoxLoginSession->SetTransmissionMode(TransmissionMode::Single, (*ChannelSessionPtr)->Channel());
-	UE_LOG(LogAccelByteVivox, Log, TEXT("Transmission set to channel: %s"), *ChannelName);
+	TRACE_COUNTER_SET(AccelByteVivoxChannels, Channels.Num());
+	TRACE_COUNTER_SET(AccelByteVivoxParticipants, ParticipantCount);
 #endif
 }
 
-void FAccelByteVivoxVoiceChat::SetTransmissionToAll()
+void FAccelByteVivoxVoiceChat::SetCoalesceTalkingEvents(bool bCoalesce)
 {
-#if VIVOX_AVAILABLE
-	if (VivoxLoginSession == nullptr)
+	if (bCoalesceTalkingEvents == bCoalesce)
 	{
-		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetTransmissionToAll: Not logged in"));
 		return;
 	}
 
-	VivoxLoginSession->SetTransmissionMode(TransmissionMode::All);
-	UE_LOG(LogAccelByteVivox, Log, TEXT("Transmission set to all channels"));
-#endif
+	// Deliver what was collected so far before switching modes
+	FlushTalkingChanges();
+	bCoalesceTalkingEvents = bCoalesce;
 }
 
-void FAccelByteVivoxVoiceChat::SetTransmissionToNone()
+bool FAccelByteVivoxVoiceChat::IsCoalescingTalkingEvents() const
 {
-#if VIVOX_AVAILABLE
-	if (VivoxLoginSession == nullptr)
+	return bCoalesceTalkingEvents;
+}
+
+void FAccelByteVivoxVoiceChat::SetChannelTalkingHysteresis(const FString& ChannelName, float AttackSeconds, float ReleaseSeconds)
+{
+	FTalkingHysteresis& Hysteresis = ChannelTalkingHysteresis.Add(ChannelName);
+	Hysteresis.AttackSeconds = FMath::Max(AttackSeconds, 0.0f);
+	Hysteresis.ReleaseSeconds = FMath::Max(ReleaseSeconds, 0.0f);
+
+	FChannelState* ChannelState = Channels.Find(GetChannelHandle(ChannelName));
+	if (ChannelState != nullptr)
 	{
-		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetTransmissionToNone: Not logged in"));
-		return;
+		ChannelState->TalkingAttackSeconds = Hysteresis.AttackSeconds;
+		ChannelState->TalkingReleaseSeconds = Hysteresis.ReleaseSeconds;
 	}
-
-	VivoxLoginSession->SetTransmissionMode(TransmissionMode::None);
-	UE_LOG(LogAccelByteVivox, Log, TEXT("Transmission set to none"));
-#endif
 }
 
-void FAccelByteVivoxVoiceChat::SetLocalMute(bool bMuted)
+void FAccelByteVivoxVoiceChat::ResetChannelTalkingHysteresis(const FString& ChannelName)
 {
-#if VIVOX_AVAILABLE
-	if (VivoxVoiceClient == nullptr)
+	ChannelTalkingHysteresis.Remove(ChannelName);
+
+	FChannelState* ChannelState = Channels.Find(GetChannelHandle(ChannelName));
+	if (ChannelState != nullptr)
 	{
-		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetLocalMute: Vivox not initialized"));
-		return;
+		const UAccelByteVivoxSettings* Settings = UAccelByteVivoxSettings::Get();
+		ChannelState->TalkingAttackSeconds = Settings->TalkingAttackSeconds;
+		ChannelState->TalkingReleaseSeconds = Settings->TalkingReleaseSeconds;
 	}
+}
 
-	bLocalMuted = bMuted;
-	VivoxVoiceClient->AudioInputDevices().SetMuted(bMuted);
-	UE_LOG(LogAccelByteVivox, Log, TEXT("Local mute set to: %s"), bMuted ? TEXT("true") : TEXT("false"));
-#endif
+FAccelByteVivoxTalkingStats FAccelByteVivoxVoiceChat::GetTalkingStats() const
+{
+	return TalkingStats;
 }
 
-bool FAccelByteVivoxVoiceChat::IsLocalMuted() const
+FAccelByteVivoxTalkingStats FAccelByteVivoxVoiceChat::GetTalkingStats(const FString& ChannelName) const
 {
-	return bLocalMuted;
+	const FChannelState* ChannelState = Channels.Find(GetChannelHandle(ChannelName));
+	return ChannelState != nullptr ? ChannelState->TalkingStats : FAccelByteVivoxTalkingStats();
 }
 
-void FAccelByteVivoxVoiceChat::SetPlayerMute(const FString& ChannelName, const FString& PlayerId, bool bMuted)
+void FAccelByteVivoxVoiceChat::ResetTalkingStats()
 {
-#if VIVOX_AVAILABLE
-	IChannelSession** ChannelSessionPtr = ChannelSessions.Find(ChannelName);
-	if (ChannelSessionPtr == nullptr || *ChannelSessionPtr == nullptr)
+	TalkingStats = FAccelByteVivoxTalkingStats();
+	for (TPair<FAccelByteVivoxChannelHandle, FChannelState>& Pair : Channels)
 	{
-		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetPlayerMute: Not in channel %s"), *ChannelName);
-		return;
+		Pair.Value.TalkingStats = FAccelByteVivoxTalkingStats();
 	}
+}
+
+void FAccelByteVivoxVoiceChat::ApplyElapsedTalkingHolds()
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(ApplyElapsedTalkingHolds);
+	const double Now = FPlatformTime::Seconds();
 
-	IParticipant* Participant = (*ChannelSessionPtr)->Participants().FindRef(PlayerId);
-	if (Participant == nullptr)
+	ElapsedTalkingHolds.Reset();
+	for (const TPair<FAccelByteVivoxChannelHandle, FChannelState>& Pair : Channels)
 	{
-		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetPlayerMute: Participant %s not found in channel %s"),
-			*PlayerId, *ChannelName);
-		return;
+		const FChannelState& ChannelState = Pair.Value;
+		for (TConstSetBitIterator<> It(ChannelState.TalkingHoldPending); It; ++It)
+		{
+			const int32 Slot = It.GetIndex();
+			const float HoldSeconds = ChannelState.RawTalking[Slot] ? ChannelState.TalkingAttackSeconds : ChannelState.TalkingReleaseSeconds;
+			if (Now - ChannelState.RawChangedAt[Slot] >= HoldSeconds)
+			{
+				ElapsedTalkingHolds.Add({ Pair.Key, ChannelState.ParticipantHandles[Slot] });
+			}
+		}
 	}
 
-	Participant->BeginSetLocalMute(bMuted,
-		IParticipant::FOnBeginSetLocalMuteCompletedDelegate::CreateLambda(
-			[PlayerId, bMuted](VivoxCoreError Error)
-			{
-				if (Error == VxErrorSuccess)
-				{
-					UE_LOG(LogAccelByteVivox, Log, TEXT("Player %s mute set to %s"),
-						*PlayerId, bMuted ? TEXT("true") : TEXT("false"));
-				}
-				else
-				{
-					UE_LOG(LogAccelByteVivox, Error, TEXT("Failed to set mute for player %s, error: %d"),
-						*PlayerId, static_cast<int32>(Error));
-				}
+	// Applied in a second pass since subscribers may change the rosters
+	for (const FAccelByteVivoxTalkingChange& Hold : ElapsedTalkingHolds)
+	{
+		FChannelState* ChannelState = Channels.Find(Hold.Channel);
+		const int32 Slot = ChannelState != nullptr ? ChannelState->FindSlot(Hold.Participant) : INDEX_NONE;
+		if (Slot != INDEX_NONE && ChannelState->TalkingHoldPending[Slot])
+		{
+			ChannelState->TalkingHoldPending[Slot] = false;
+			ApplyTalkingChange(Hold.Channel, *ChannelState, Slot, ChannelState->RawTalking[Slot]);
+		}
+	}
+}
+
+void FAccelByteVivoxVoiceChat::SubscribeAudioEnergy(const FString& ChannelName)
+{
+	++AudioEnergySubscriptions.FindOrAdd(ChannelName);
+
+	FChannelState* ChannelState = Channels.Find(GetChannelHandle(ChannelName));
+	if (ChannelState != nullptr)
+	{
+		ChannelState->bSampleAudioEnergy = true;
+	}
+}
+
+void FAccelByteVivoxVoiceChat::UnsubscribeAudioEnergy(const FString& ChannelName)
+{
+	int32* SubscriptionCount = AudioEnergySubscriptions.Find(ChannelName);
+	if (SubscriptionCount == nullptr)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("UnsubscribeAudioEnergy: No subscription for channel %s"), *ChannelName);
+		return;
+	}
+
+	if (--(*SubscriptionCount) > 0)
+	{
+		return;
+	}
+	AudioEnergySubscriptions.Remove(ChannelName);
+
+	FChannelState* ChannelState = Channels.Find(GetChannelHandle(ChannelName));
+	if (ChannelState != nullptr)
+	{
+		ChannelState->bSampleAudioEnergy = false;
+		ChannelState->AudioEnergySnapshot = FAccelByteVivoxAudioEnergySnapshot();
+	}
+}
+
+const FAccelByteVivoxAudioEnergySnapshot* FAccelByteVivoxVoiceChat::GetAudioEnergySnapshot(const FString& ChannelName) const
+{
+	return GetAudioEnergySnapshot(GetChannelHandle(ChannelName));
+}
+
+const FAccelByteVivoxAudioEnergySnapshot* FAccelByteVivoxVoiceChat::GetAudioEnergySnapshot(FAccelByteVivoxChannelHandle Channel) const
+{
+	const FChannelState* ChannelState = Channels.Find(Channel);
+	return ChannelState != nullptr && ChannelState->bSampleAudioEnergy ? &ChannelState->AudioEnergySnapshot : nullptr;
+}
+
+void FAccelByteVivoxVoiceChat::SampleAudioEnergy()
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(SampleAudioEnergy);
+	const double Now = FPlatformTime::Seconds();
+	const double SampleInterval = 1.0 / FMath::Max(UAccelByteVivoxSettings::Get()->AudioEnergySampleRateHz, 1.0f);
+
+	for (TPair<FAccelByteVivoxChannelHandle, FChannelState>& Pair : Channels)
+	{
+		FChannelState& ChannelState = Pair.Value;
+		if (!ChannelState.bSampleAudioEnergy || Now < ChannelState.NextAudioEnergySampleAt)
+		{
+			continue;
+		}
+
+		// Rewritten in place so the buffers keep their capacity across samples
+		FAccelByteVivoxAudioEnergySnapshot& Snapshot = ChannelState.AudioEnergySnapshot;
+		Snapshot.Participants.Reset();
+		Snapshot.Participants.Append(ChannelState.ParticipantHandles);
+		Snapshot.Energies.Reset();
+		Snapshot.Energies.Append(ChannelState.AudioEnergies);
+		Snapshot.Timestamps.Reset();
+		Snapshot.Timestamps.Append(ChannelState.AudioEnergyUpdatedAt);
+		Snapshot.SampledAt = Now;
+		++Snapshot.Sequence;
+
+		// Stay on the sampling grid unless a hitch put us more than one interval behind
+		ChannelState.NextAudioEnergySampleAt = FMath::Max(ChannelState.NextAudioEnergySampleAt + SampleInterval, Now);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::FlushTalkingChanges()
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(FlushTalkingChanges);
+	if (PendingTalkingChanges.Num() == 0)
+	{
+		return;
+	}
+
+	TalkingChangeSet.Started.Reset();
+	TalkingChangeSet.Stopped.Reset();
+
+	for (const FAccelByteVivoxTalkingChange& Change : PendingTalkingChanges)
+	{
+		// Entries for participants or channels that went away during the tick are dropped
+		FChannelState* ChannelState = Channels.Find(Change.Channel);
+		const int32 Slot = ChannelState != nullptr ? ChannelState->FindSlot(Change.Participant) : INDEX_NONE;
+		if (Slot == INDEX_NONE)
+		{
+			continue;
+		}
+
+		ChannelState->TalkingChangePending[Slot] = false;
+		const bool bTalking = ChannelState->Talking[Slot];
+		if (ChannelState->ReportedTalking[Slot] == bTalking)
+		{
+			continue;
+		}
+
+		ChannelState->ReportedTalking[Slot] = bTalking;
+		(bTalking ? TalkingChangeSet.Started : TalkingChangeSet.Stopped).Add(Change);
+	}
+	PendingTalkingChanges.Reset();
+
+	if (!TalkingChangeSet.IsEmpty())
+	{
+		OnParticipantTalkingBatch.Broadcast(TalkingChangeSet);
+	}
+}
+
+FAccelByteVivoxLatencySummary FAccelByteVivoxVoiceChat::GetLatencySummary(EAccelByteVivoxLatencyStage Stage) const
+{
+	return GetLatencyHistogram(Stage).GetSummary();
+}
+
+const FAccelByteVivoxLatencyHistogram& FAccelByteVivoxVoiceChat::GetLatencyHistogram(EAccelByteVivoxLatencyStage Stage) const
+{
+	check(Stage < EAccelByteVivoxLatencyStage::Count);
+	return LatencyHistograms[static_cast<int32>(Stage)];
+}
+
+void FAccelByteVivoxVoiceChat::ResetLatencyStats()
+{
+	for (FAccelByteVivoxLatencyHistogram& Histogram : LatencyHistograms)
+	{
+		Histogram.Reset();
+	}
+}
+
+void FAccelByteVivoxVoiceChat::RecordLatency(EAccelByteVivoxLatencyStage Stage, double Seconds)
+{
+	LatencyHistograms[static_cast<int32>(Stage)].Add(Seconds);
+}
+
+FString FAccelByteVivoxVoiceChat::GetLatencyStatsCsv() const
+{
+	FString Csv = TEXT("Stage,Count,MinMs,MeanMs,P50Ms,P95Ms,P99Ms,MaxMs\n");
+	for (int32 Index = 0; Index < static_cast<int32>(EAccelByteVivoxLatencyStage::Count); ++Index)
+	{
+		const EAccelByteVivoxLatencyStage Stage = static_cast<EAccelByteVivoxLatencyStage>(Index);
+		const FAccelByteVivoxLatencySummary Summary = LatencyHistograms[Index].GetSummary();
+		Csv += FString::Printf(TEXT("%s,%llu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n"), LexToString(Stage), Summary.Count,
+			Summary.MinSeconds * 1000.0, Summary.MeanSeconds * 1000.0, Summary.P50Seconds * 1000.0, Summary.P95Seconds * 1000.0,
+			Summary.P99Seconds * 1000.0, Summary.MaxSeconds * 1000.0);
+	}
+	return Csv;
+}
+
+bool FAccelByteVivoxVoiceChat::SaveLatencyStatsCsv(const FString& FilePath) const
+{
+	const FString OutputPath = FilePath.IsEmpty()
+		? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AccelByteVivox"), TEXT("Latency.csv"))
+		: FilePath;
+
+	if (!FFileHelper::SaveStringToFile(GetLatencyStatsCsv(), *OutputPath))
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("SaveLatencyStatsCsv: Failed to write %s"), *OutputPath);
+		return false;
+	}
+	return true;
+}
+
+void FAccelByteVivoxVoiceChat::PrefetchLoginToken(const AccelByte::FApiClientPtr& ApiClient, const FString& InUsername)
+{
+	if (CurrentLoginState != EVivoxLoginState::NotLoggedIn)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("PrefetchLoginToken: Already logged in or login in progress"));
+		return;
+	}
+
+	if (!ApiClient.IsValid())
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("PrefetchLoginToken: Invalid ApiClient"));
+		return;
+	}
+
+	// The token request does not need an initialized client, so this may run ahead of Initialize()
+	if (!Backend.IsValid())
+	{
+		Backend = CreateDefaultBackend();
+	}
+
+	if (!Backend.IsValid())
+	{
+		return;
+	}
+
+	if (!IsLoginTokenUsable(InUsername))
+	{
+		RequestLoginToken(ApiClient, InUsername);
+	}
+
+	if (bInitialized)
+	{
+		Backend->PrepareLogin(InUsername);
+	}
+}
+
+FAccelByteVivoxOperationHandle FAccelByteVivoxVoiceChat::Login(const AccelByte::FApiClientPtr& ApiClient, const FString& InUsername)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(Login);
+	if (!bInitialized)
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("Login failed: Vivox not initialized. Call Initialize() first"));
+		BroadcastLoginCompleted(false, FAccelByteVivoxLoginTimings());
+		return FAccelByteVivoxOperationHandle();
+	}
+
+	if (CurrentLoginState != EVivoxLoginState::NotLoggedIn)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("Login failed: Already logged in or login in progress"));
+		BroadcastLoginCompleted(false, FAccelByteVivoxLoginTimings());
+		return FAccelByteVivoxOperationHandle();
+	}
+
+	if (PendingShutdown.bActive)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("Login failed: Shutting down"));
+		BroadcastLoginCompleted(false, FAccelByteVivoxLoginTimings());
+		return FAccelByteVivoxOperationHandle();
+	}
+
+	if (!ApiClient.IsValid())
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("Login failed: Invalid ApiClient"));
+		BroadcastLoginCompleted(false, FAccelByteVivoxLoginTimings());
+		return FAccelByteVivoxOperationHandle();
+	}
+
+	ApiClientPtr = ApiClient;
+	Username = InUsername;
+	ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Login %s"), *Username);
+	CurrentLoginState = EVivoxLoginState::LoggingIn;
+	++LoginAttempt;
+	LoginOperation = FAccelByteVivoxOperationHandle(++LastOperationHandle);
+	LoginTimings = FAccelByteVivoxLoginTimings();
+	LoginStartedAt = FPlatformTime::Seconds();
+
+	// The login session is set up while the token request is in flight rather than after it
+	Backend->PrepareLogin(Username);
+
+	if (!IsLoginTokenUsable(Username))
+	{
+		RequestLoginToken(ApiClientPtr, Username);
+		return LoginOperation;
+	}
+
+	LoginTimings.bTokenPrefetched = true;
+	if (LoginToken.bReceived)
+	{
+		UE_LOG(LogAccelByteVivox, Log, TEXT("Login: Using prefetched login token"));
+		BeginLoginSession();
+	}
+	// Otherwise the prefetch is still in flight and the login continues when it lands
+
+	// Invalid if the login session already failed to start
+	return LoginOperation;
+}
+
+bool FAccelByteVivoxVoiceChat::IsLoginTokenUsable(const FString& InUsername) const
+{
+	if (LoginToken.RequestId == 0 || LoginToken.Username != InUsername)
+	{
+		return false;
+	}
+
+	const UAccelByteVivoxSettings* Settings = UAccelByteVivoxSettings::Get();
+	return !LoginToken.bReceived || FPlatformTime::Seconds() < LoginToken.ReceivedAt + Settings->LoginTokenCacheLifetimeSeconds;
+}
+
+void FAccelByteVivoxVoiceChat::RequestLoginToken(const AccelByte::FApiClientPtr& ApiClient, const FString& InUsername)
+{
+	const uint32 RequestId = ++LastLoginTokenRequestId;
+
+	LoginToken = FLoginToken();
+	LoginToken.Username = InUsername;
+	LoginToken.RequestId = RequestId;
+	LoginToken.RequestedAt = FPlatformTime::Seconds();
+
+	// Request login token from AccelByte
+	FAccelByteVivoxTokenRequest Request;
+	Request.Type = EAccelByteVivoxTokenType::Login;
+	Request.Username = InUsername;
+
+	Backend->RequestToken(
+		ApiClient,
+		Request,
+		FOnAccelByteVivoxTokenReceived::CreateLambda([this, RequestId](const FString& AccessToken, const FString& Uri)
+		{
+			FQueuedEvent Event;
+			Event.Type = EQueuedEventType::LoginTokenReceived;
+			Event.RequestId = RequestId;
+			Event.AccessToken = AccessToken;
+			Event.Uri = Uri;
+			EnqueueEvent(MoveTemp(Event));
+		}),
+		FOnAccelByteVivoxTokenFailed::CreateLambda([this, RequestId](int32 ErrorCode, const FString& ErrorMessage)
+		{
+			FQueuedEvent Event;
+			Event.Type = EQueuedEventType::LoginTokenFailed;
+			Event.RequestId = RequestId;
+			Event.Error = ErrorCode;
+			Event.ErrorMessage = ErrorMessage;
+			EnqueueEvent(MoveTemp(Event));
+		})
+	);
+}
+
+void FAccelByteVivoxVoiceChat::HandleLoginTokenReceived(const FString& AccessToken, const FString& Uri)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleLoginTokenReceived);
+	LoginToken.bReceived = true;
+	LoginToken.ReceivedAt = FPlatformTime::Seconds();
+	LoginToken.AccessToken = AccessToken;
+	LoginToken.Uri = Uri;
+	RecordLatency(EAccelByteVivoxLatencyStage::LoginToken, LoginToken.ReceivedAt - LoginToken.RequestedAt);
+
+	if (CurrentLoginState == EVivoxLoginState::LoggingIn)
+	{
+		BeginLoginSession();
+		return;
+	}
+
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Prefetched login token for user %s"), *LoginToken.Username);
+}
+
+void FAccelByteVivoxVoiceChat::HandleLoginTokenFailed(int32 ErrorCode, const FString& ErrorMessage)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleLoginTokenFailed);
+	LoginToken = FLoginToken();
+
+	UE_LOG(LogAccelByteVivox, Error, TEXT("Failed to get login token. Code: %d, Message: %s"), ErrorCode, *ErrorMessage);
+	if (CurrentLoginState == EVivoxLoginState::LoggingIn)
+	{
+		CompleteLogin(false);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::BeginLoginSession()
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(BeginLoginSession);
+	// Tokens are single use
+	const FString AccessToken = MoveTemp(LoginToken.AccessToken);
+	LoginTimings.TokenRequestSeconds = LoginToken.ReceivedAt - LoginToken.RequestedAt;
+	LoginTimings.TokenWaitSeconds = FMath::Max(LoginToken.ReceivedAt - LoginStartedAt, 0.0);
+	LoginToken = FLoginToken();
+
+	const UAccelByteVivoxSettings* Settings = UAccelByteVivoxSettings::Get();
+	const FString LoginServerUri = Settings->VivoxServer;
+	if (LoginServerUri.IsEmpty())
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("Vivox login failed: server URI missing. Set VivoxServer in AccelByteVivox settings."));
+		CompleteLogin(false);
+		return;
+	}
+
+	SessionLoginStartedAt = FPlatformTime::Seconds();
+
+	const uint32 Attempt = LoginAttempt;
+	const int32 Error = Backend->BeginLogin(
+		Username,
+		LoginServerUri,
+		AccessToken,
+		FOnAccelByteVivoxBackendCompleted::CreateLambda([this, Attempt](int32 LoginError)
+		{
+			FQueuedEvent Event;
+			Event.Type = EQueuedEventType::LoginCompleted;
+			Event.RequestId = Attempt;
+			Event.Error = LoginError;
+			EnqueueEvent(MoveTemp(Event));
+		}));
+
+	if (Error != IAccelByteVivoxBackend::Success)
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("BeginLogin failed with error: %d"), Error);
+		CompleteLogin(false);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::HandleVivoxLoginCompleted(int32 Error)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleVivoxLoginCompleted);
+	if (CurrentLoginState != EVivoxLoginState::LoggingIn)
+	{
+		return;
+	}
+
+	LoginTimings.SessionLoginSeconds = FPlatformTime::Seconds() - SessionLoginStartedAt;
+
+	if (Error == IAccelByteVivoxBackend::Success)
+	{
+		UE_LOG(LogAccelByteVivox, Log, TEXT("Vivox login successful for user: %s"), *Username);
+		RecordLatency(EAccelByteVivoxLatencyStage::LoginSession, LoginTimings.SessionLoginSeconds);
+		CompleteLogin(true);
+	}
+	else
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("Vivox login failed with error: %d"), Error);
+		CompleteLogin(false);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::CompleteLogin(bool bSuccess)
+{
+	LoginOperation = FAccelByteVivoxOperationHandle();
+	CurrentLoginState = bSuccess ? EVivoxLoginState::LoggedIn : EVivoxLoginState::NotLoggedIn;
+	LoginTimings.TotalSeconds = FPlatformTime::Seconds() - LoginStartedAt;
+
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Login stages: token %.3fs (waited %.3fs%s), session %.3fs, total %.3fs"),
+		LoginTimings.TokenRequestSeconds, LoginTimings.TokenWaitSeconds, LoginTimings.bTokenPrefetched ? TEXT(", prefetched") : TEXT(""),
+		LoginTimings.SessionLoginSeconds, LoginTimings.TotalSeconds);
+	ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Login %s"), bSuccess ? TEXT("succeeded") : TEXT("failed"));
+	if (bSuccess)
+	{
+		RecordLatency(EAccelByteVivoxLatencyStage::Login, LoginTimings.TotalSeconds);
+	}
+
+	BroadcastLoginCompleted(bSuccess, LoginTimings);
+	HandleLoginRecoveryResult(bSuccess);
+}
+
+void FAccelByteVivoxVoiceChat::BroadcastLoginCompleted(bool bSuccess, const FAccelByteVivoxLoginTimings& Timings)
+{
+	OnLoginCompleted.Broadcast(bSuccess);
+	OnLoginCompletedWithTimings.Broadcast(bSuccess, Timings);
+}
+
+bool FAccelByteVivoxVoiceChat::CancelLogin()
+{
+	if (CurrentLoginState != EVivoxLoginState::LoggingIn)
+	{
+		return false;
+	}
+
+	++CancellationStats.Cancelled;
+	if (LoginToken.RequestId != 0 && !LoginToken.bReceived)
+	{
+		// The response no longer matches a request when it lands, so the Vivox login is never started
+		LoginToken = FLoginToken();
+		++CancellationStats.SkippedLogins;
+		UE_LOG(LogAccelByteVivox, Log, TEXT("Login cancelled before the login token arrived"));
+	}
+	else
+	{
+		// The Vivox login is under way; its completion is ignored once the state has moved on
+		Backend->Logout();
+		UE_LOG(LogAccelByteVivox, Log, TEXT("Login cancelled during the Vivox login"));
+	}
+
+	ApiClientPtr.Reset();
+	CompleteLogin(false);
+	return true;
+}
+
+void FAccelByteVivoxVoiceChat::OnBackendLoggedOut()
+{
+	FQueuedEvent Event;
+	Event.Type = EQueuedEventType::LoggedOut;
+	EnqueueEvent(MoveTemp(Event));
+}
+
+void FAccelByteVivoxVoiceChat::HandleLoggedOut()
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleLoggedOut);
+	if (CurrentLoginState == EVivoxLoginState::NotLoggedIn)
+	{
+		// Already handled by Logout()
+		return;
+	}
+
+	if (CurrentLoginState == EVivoxLoginState::LoggingIn)
+	{
+		// Dropped before the login completed, so the login failed; a completion arriving later is ignored. No channel
+		// can have been joined yet, and a recovery login retries from CompleteLogin.
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("Vivox login session logged out while logging in"));
+		ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Login session lost while logging in"));
+		LoginTimings.SessionLoginSeconds = FPlatformTime::Seconds() - SessionLoginStartedAt;
+		DropJoinTokens();
+		CompleteLogin(false);
+		return;
+	}
+
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Vivox login session logged out"));
+	ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Login session lost"));
+	CurrentLoginState = EVivoxLoginState::NotLoggedIn;
+	DropJoinTokens();
+
+	const bool bReconnect = UAccelByteVivoxSettings::Get()->bAutoReconnect && ApiClientPtr.IsValid() && !PendingShutdown.bActive;
+
+	// The channel sessions went down with the login session; with reconnect on they are rejoined once it is back
+	const double Now = FPlatformTime::Seconds();
+	TArray<FAccelByteVivoxChannelHandle> LostChannels;
+	Channels.GetKeys(LostChannels);
+	for (const FAccelByteVivoxChannelHandle Channel : LostChannels)
+	{
+		// A handler of an earlier channel may have left this one already
+		const FChannelState* ChannelState = Channels.Find(Channel);
+		if (ChannelState == nullptr)
+		{
+			continue;
+		}
+
+		const FString ChannelName = ChannelState->ChannelName;
+		if (bReconnect && !ChannelState->bLeaveRequested)
+		{
+			BeginChannelRejoin(*ChannelState, Now);
+		}
+
+		const bool bJoinPending = !ChannelState->bConnected && PendingJoins.Contains(ChannelName);
+		CleanUpChannelSession(Channel);
+		if (bJoinPending)
+		{
+			// Lost before the connect finished, so the join failed
+			CompleteChannelJoin(ChannelName, false);
+		}
+		OnChannelLeft.Broadcast(ChannelName);
+	}
+
+	if (!bReconnect)
+	{
+		// Nothing will be restored without a login, including channels still waiting to be rejoined
+		CancelReconnect();
+		OnLogoutCompleted.Broadcast();
+		return;
+	}
+
+	if (!LoginRecovery.bActive)
+	{
+		LoginRecovery.bActive = true;
+		LoginRecovery.LostAt = Now;
+	}
+	LoginRecovery.bInFlight = false;
+
+	if (!ScheduleReconnectAttempt(FString(), LoginRecovery.Attempt, LoginRecovery.NextAttemptAt))
+	{
+		AbandonLoginRecovery();
+	}
+}
+
+void FAccelByteVivoxVoiceChat::Logout()
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(Logout);
+	if (bInitialized && LoginRecovery.bActive && CurrentLoginState == EVivoxLoginState::NotLoggedIn)
+	{
+		// Between reconnect attempts there is no session left, so logging out only stops the attempts
+		CancelReconnect();
+		ApiClientPtr.Reset();
+		TransmissionMode = ETransmissionMode::Default;
+
+		UE_LOG(LogAccelByteVivox, Log, TEXT("Vivox logged out"));
+		ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Logged out"));
+		OnLogoutCompleted.Broadcast();
+		return;
+	}
+
+	if (!bInitialized || CurrentLoginState == EVivoxLoginState::NotLoggedIn)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("Logout: Not logged in"));
+		return;
+	}
+
+	CancelReconnect();
+	LeaveAllChannels();
+
+	Backend->Logout();
+	CurrentLoginState = EVivoxLoginState::NotLoggedIn;
+	LoginOperation = FAccelByteVivoxOperationHandle();
+	ApiClientPtr.Reset();
+	TransmissionMode = ETransmissionMode::Default;
+	DropJoinTokens();
+
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Vivox logged out"));
+	ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Logged out"));
+	OnLogoutCompleted.Broadcast();
+}
+
+bool FAccelByteVivoxVoiceChat::IsLoggedIn() const
+{
+	return CurrentLoginState == EVivoxLoginState::LoggedIn;
+}
+
+bool FAccelByteVivoxVoiceChat::CancelOperation(FAccelByteVivoxOperationHandle Operation)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(CancelOperation);
+	if (!Operation.IsValid())
+	{
+		return false;
+	}
+
+	if (Operation == LoginOperation)
+	{
+		return CancelLogin();
+	}
+
+	FString ChannelName;
+	if (!JoinOperations.RemoveAndCopyValue(Operation, ChannelName))
+	{
+		return false;
+	}
+
+	FPendingJoin& PendingJoin = PendingJoins.FindChecked(ChannelName);
+	PendingJoin.Operations.RemoveSingleSwap(Operation);
+	if (PendingJoin.Operations.Num() > 0)
+	{
+		UE_LOG(LogAccelByteVivox, Log, TEXT("CancelOperation: Join of channel %s goes on for %d other requests"),
+			*ChannelName, PendingJoin.Operations.Num());
+		return true;
+	}
+
+	if (!CancelJoinBeforeConnect(ChannelName))
+	{
+		// Already connecting; the disconnect that follows the leave fails the join
+		++CancellationStats.Cancelled;
+		LeaveChannel(ChannelName);
+	}
+	return true;
+}
+
+FAccelByteVivoxCancellationStats FAccelByteVivoxVoiceChat::GetCancellationStats() const
+{
+	return CancellationStats;
+}
+
+bool FAccelByteVivoxVoiceChat::IsReconnecting() const
+{
+	return LoginRecovery.bActive || ChannelRejoins.Num() > 0;
+}
+
+FAccelByteVivoxReconnectStats FAccelByteVivoxVoiceChat::GetReconnectStats() const
+{
+	return ReconnectStats;
+}
+
+bool FAccelByteVivoxVoiceChat::ScheduleReconnectAttempt(const FString& ChannelName, int32& Attempt, double& NextAttemptAt)
+{
+	const UAccelByteVivoxSettings* Settings = UAccelByteVivoxSettings::Get();
+	if (Settings->ReconnectMaxAttempts > 0 && Attempt >= Settings->ReconnectMaxAttempts)
+	{
+		return false;
+	}
+
+	++Attempt;
+
+	// Exponential backoff; part of every delay is random so clients dropped by the same outage spread their retries
+	const float BaseDelay = FMath::Min(Settings->ReconnectInitialDelaySeconds * FMath::Pow(2.0f, FMath::Min(Attempt - 1, 16)),
+		Settings->ReconnectMaxDelaySeconds);
+	const float Delay = BaseDelay * (1.0f - Settings->ReconnectJitter * FMath::FRand());
+	NextAttemptAt = FPlatformTime::Seconds() + Delay;
+
+	if (ChannelName.IsEmpty())
+	{
+		UE_LOG(LogAccelByteVivox, Log, TEXT("Reconnecting login session in %.2fs (attempt %d)"), Delay, Attempt);
+		ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Reconnect login session (attempt %d)"), Attempt);
+	}
+	else
+	{
+		UE_LOG(LogAccelByteVivox, Log, TEXT("Rejoining channel %s in %.2fs (attempt %d)"), *ChannelName, Delay, Attempt);
+		ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Rejoin %s (attempt %d)"), *ChannelName, Attempt);
+	}
+	OnReconnecting.Broadcast(ChannelName, Attempt, Delay);
+	return true;
+}
+
+void FAccelByteVivoxVoiceChat::UpdateReconnect()
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(UpdateReconnect);
+	if (!LoginRecovery.bActive && ChannelRejoins.Num() == 0)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+
+	if (LoginRecovery.bActive && !LoginRecovery.bInFlight && CurrentLoginState == EVivoxLoginState::NotLoggedIn
+		&& Now >= LoginRecovery.NextAttemptAt)
+	{
+		LoginRecovery.bInFlight = true;
+		++ReconnectStats.Attempts;
+		Login(ApiClientPtr, Username);
+	}
+
+	// Channels only rejoin on a live login session, and all that are due go at once
+	if (CurrentLoginState != EVivoxLoginState::LoggedIn)
+	{
+		return;
+	}
+
+	TArray<FString> DueChannelNames;
+	for (const TPair<FString, FChannelRejoin>& Pair : ChannelRejoins)
+	{
+		if (!Pair.Value.bInFlight && Now >= Pair.Value.NextAttemptAt)
+		{
+			DueChannelNames.Add(Pair.Key);
+		}
+	}
+
+	for (const FString& ChannelName : DueChannelNames)
+	{
+		// An earlier JoinChannel in this loop may have completed, and changed the rejoins, synchronously
+		FChannelRejoin* Rejoin = ChannelRejoins.Find(ChannelName);
+		if (Rejoin == nullptr || Rejoin->bInFlight)
+		{
+			continue;
+		}
+
+		Rejoin->bInFlight = true;
+		++ReconnectStats.Attempts;
+		if (Rejoin->bStandby)
+		{
+			StandbyJoins.Add(ChannelName);
+		}
+		if (Rejoin->bPositional)
+		{
+			JoinPositionalChannel(ChannelName, Rejoin->PositionalProperties);
+		}
+		else
+		{
+			JoinChannel(ChannelName);
+		}
+	}
+}
+
+void FAccelByteVivoxVoiceChat::HandleLoginRecoveryResult(bool bSuccess)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleLoginRecoveryResult);
+	if (!LoginRecovery.bActive)
+	{
+		return;
+	}
+
+	const bool bRecoveryAttempt = LoginRecovery.bInFlight;
+	LoginRecovery.bInFlight = false;
+
+	if (bSuccess)
+	{
+		// Restore what does not depend on a channel, then rejoin every lost channel right away
+		if (bLocalMuted)
+		{
+			Backend->SetInputMuted(true);
+		}
+
+		if (TransmissionMode == ETransmissionMode::All)
+		{
+			Backend->SetTransmissionToAll();
+		}
+		else if (TransmissionMode == ETransmissionMode::None)
+		{
+			Backend->SetTransmissionToNone();
+		}
+
+		for (TPair<FString, FChannelRejoin>& Pair : ChannelRejoins)
+		{
+			Pair.Value.NextAttemptAt = 0.0;
+		}
+
+		CompleteLoginRecoveryIfDone();
+		return;
+	}
+
+	// A Login() made by the game while waiting for the next attempt does not count against the recovery
+	if (!bRecoveryAttempt)
+	{
+		return;
+	}
+
+	if (!ScheduleReconnectAttempt(FString(), LoginRecovery.Attempt, LoginRecovery.NextAttemptAt))
+	{
+		AbandonLoginRecovery();
+	}
+}
+
+void FAccelByteVivoxVoiceChat::AbandonLoginRecovery()
+{
+	const double RecoverySeconds = FPlatformTime::Seconds() - LoginRecovery.LostAt;
+	UE_LOG(LogAccelByteVivox, Warning, TEXT("Giving up reconnecting after %d attempts"), LoginRecovery.Attempt);
+	++ReconnectStats.Failures;
+	CancelReconnect();
+
+	OnReconnected.Broadcast(FString(), false, RecoverySeconds);
+	OnLogoutCompleted.Broadcast();
+}
+
+void FAccelByteVivoxVoiceChat::HandleChannelRejoinResult(const FString& ChannelName, bool bSuccess)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleChannelRejoinResult);
+	FChannelRejoin* Rejoin = ChannelRejoins.Find(ChannelName);
+	if (Rejoin == nullptr || !Rejoin->bInFlight)
+	{
+		return;
+	}
+
+	Rejoin->bInFlight = false;
+
+	if (bSuccess && Rejoin->bCancelled)
+	{
+		ChannelRejoins.Remove(ChannelName);
+		LeaveChannel(ChannelName);
+	}
+	else if (bSuccess)
+	{
+		const FAccelByteVivoxChannelHandle Channel = GetChannelHandle(ChannelName);
+		FChannelState* ChannelState = Channels.Find(Channel);
+		if (ChannelState != nullptr)
+		{
+			ChannelState->MutesToRestore = MoveTemp(Rejoin->MutedPlayers);
+			RestorePlayerMutes(*ChannelState);
+		}
+
+		if (TransmissionMode == ETransmissionMode::Channel && TransmissionChannelName == ChannelName)
+		{
+			ApplyTransmission();
+		}
+
+		const double RecoverySeconds = RecordRecovery(Rejoin->LostAt);
+		ChannelRejoins.Remove(ChannelName);
+
+		UE_LOG(LogAccelByteVivox, Log, TEXT("Channel %s restored after %.2fs"), *ChannelName, RecoverySeconds);
+		OnReconnected.Broadcast(ChannelName, true, RecoverySeconds);
+	}
+	else if (Rejoin->bCancelled)
+	{
+		ChannelRejoins.Remove(ChannelName);
+	}
+	else if (!ScheduleReconnectAttempt(ChannelName, Rejoin->Attempt, Rejoin->NextAttemptAt))
+	{
+		const double RecoverySeconds = FPlatformTime::Seconds() - Rejoin->LostAt;
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("Giving up rejoining channel %s after %d attempts"), *ChannelName, Rejoin->Attempt);
+		ChannelRejoins.Remove(ChannelName);
+		++ReconnectStats.Failures;
+		LoginRecovery.bChannelsFailed = true;
+
+		OnReconnected.Broadcast(ChannelName, false, RecoverySeconds);
+	}
+
+	CompleteLoginRecoveryIfDone();
+}
+
+void FAccelByteVivoxVoiceChat::CompleteLoginRecoveryIfDone()
+{
+	if (!LoginRecovery.bActive || CurrentLoginState != EVivoxLoginState::LoggedIn || ChannelRejoins.Num() > 0)
+	{
+		return;
+	}
+
+	const bool bSuccess = !LoginRecovery.bChannelsFailed;
+	const double RecoverySeconds = RecordRecovery(LoginRecovery.LostAt);
+	LoginRecovery = FLoginRecovery();
+
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Vivox session restored after %.2fs"), RecoverySeconds);
+	ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Session restored"));
+	OnReconnected.Broadcast(FString(), bSuccess, RecoverySeconds);
+}
+
+double FAccelByteVivoxVoiceChat::RecordRecovery(double LostAt)
+{
+	const double RecoverySeconds = FPlatformTime::Seconds() - LostAt;
+	++ReconnectStats.Recoveries;
+	ReconnectStats.LastRecoverySeconds = RecoverySeconds;
+	ReconnectStats.MaxRecoverySeconds = FMath::Max(ReconnectStats.MaxRecoverySeconds, RecoverySeconds);
+	ReconnectStats.TotalRecoverySeconds += RecoverySeconds;
+	return RecoverySeconds;
+}
+
+void FAccelByteVivoxVoiceChat::CancelReconnect()
+{
+	LoginRecovery = FLoginRecovery();
+	ChannelRejoins.Empty();
+}
+
+FAccelByteVivoxOperationHandle FAccelByteVivoxVoiceChat::JoinChannel(const FString& ChannelName)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(JoinChannel);
+	if (CurrentLoginState != EVivoxLoginState::LoggedIn)
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("JoinChannel failed: Not logged in"));
+		CompleteChannelJoin(ChannelName, false);
+		return FAccelByteVivoxOperationHandle();
+	}
+
+	if (PendingShutdown.bActive)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("JoinChannel failed: Shutting down"));
+		CompleteChannelJoin(ChannelName, false);
+		return FAccelByteVivoxOperationHandle();
+	}
+
+	// Checked before sharing a join in flight: a session being left, including one whose join was cancelled while it
+	// connected, is going away, so sharing its join or reporting it as joined would both end in a channel the caller
+	// is not in
+	const FAccelByteVivoxChannelHandle* ExistingChannel = ChannelHandlesByName.Find(ChannelName);
+	const FChannelState* ExistingChannelState = ExistingChannel != nullptr ? Channels.Find(*ExistingChannel) : nullptr;
+	if (ExistingChannelState != nullptr && ExistingChannelState->bLeaveRequested)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("JoinChannel failed: Channel %s is being left; join again once OnChannelLeft fires"),
+			*ChannelName);
+		CompleteChannelJoin(ChannelName, false);
+		return FAccelByteVivoxOperationHandle();
+	}
+
+	if (FPendingJoin* PendingJoin = PendingJoins.Find(ChannelName))
+	{
+		const FAccelByteVivoxOperationHandle Operation(++LastOperationHandle);
+		PendingJoin->Operations.Add(Operation);
+		JoinOperations.Add(Operation, ChannelName);
+		UE_LOG(LogAccelByteVivox, Log, TEXT("JoinChannel: Join of channel %s already in progress, sharing it (%d requests)"),
+			*ChannelName, PendingJoin->Operations.Num());
+		return Operation;
+	}
+
+	if (ExistingChannel != nullptr)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("JoinChannel: Already in channel %s"), *ChannelName);
+		CompleteChannelJoin(ChannelName, true);
+		return FAccelByteVivoxOperationHandle();
+	}
+
+	// Fail before spending a token request; the eviction itself waits until the channel is about to connect
+	if (MaxConcurrentChannels > 0 && GetBudgetedChannelCount() >= MaxConcurrentChannels
+		&& !FindChannelToEvict(GetChannelPriority(ChannelName)).IsValid())
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("JoinChannel failed: All %d channels in the budget outrank channel %s"),
+			MaxConcurrentChannels, *ChannelName);
+		CompleteChannelJoin(ChannelName, false);
+		return FAccelByteVivoxOperationHandle();
+	}
+
+	const FAccelByteVivoxOperationHandle Operation(++LastOperationHandle);
+	FPendingJoin& PendingJoin = PendingJoins.Add(ChannelName);
+	PendingJoin.StartedAt = FPlatformTime::Seconds();
+	PendingJoin.Operations.Add(Operation);
+	JoinOperations.Add(Operation, ChannelName);
+	ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Join %s"), *ChannelName);
+
+	// Positional and non-positional channels take different tokens
+	const bool bPositional = PositionalJoins.Contains(ChannelName);
+
+	FString AccessToken;
+	FString Uri;
+	if (ConsumeCachedJoinToken(ChannelName, bPositional, AccessToken, Uri))
+	{
+		UE_LOG(LogAccelByteVivox, Log, TEXT("JoinChannel: Using prefetched join token for channel %s"), *ChannelName);
+		HandleJoinTokenResponse(ChannelName, AccessToken, Uri);
+		// Invalid if the join already failed
+		return JoinOperations.Contains(Operation) ? Operation : FAccelByteVivoxOperationHandle();
+	}
+
+	FPendingJoinToken* PendingJoinToken = PendingJoinTokens.Find(ChannelName);
+	if (PendingJoinToken != nullptr && PendingJoinToken->bPositional == bPositional)
+	{
+		// A prefetch is already in flight; join as soon as it lands instead of requesting a second token
+		PendingJoinToken->bJoinRequested = true;
+		return Operation;
+	}
+
+	if (!ApiClientPtr.IsValid())
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("JoinChannel failed: ApiClient is invalid"));
+		CompleteChannelJoin(ChannelName, false);
+		return FAccelByteVivoxOperationHandle();
+	}
+
+	RequestJoinToken(ChannelName, true);
+	return Operation;
+}
+
+void FAccelByteVivoxVoiceChat::JoinChannels(const TArray<FString>& ChannelNames, const FOnVivoxJoinChannelsCompleted& OnCompleted)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(JoinChannels);
+	FJoinChannelsBatch Batch;
+	Batch.OnCompleted = OnCompleted;
+
+	TArray<FString> UniqueChannelNames;
+	for (const FString& ChannelName : ChannelNames)
+	{
+		if (!ChannelName.IsEmpty() && !Batch.PendingChannels.Contains(ChannelName))
+		{
+			Batch.PendingChannels.Add(ChannelName);
+			UniqueChannelNames.Add(ChannelName);
+		}
+	}
+
+	if (UniqueChannelNames.Num() == 0)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("JoinChannels: No channels to join"));
+		OnCompleted.ExecuteIfBound(Batch.Results);
+		return;
+	}
+
+	JoinChannelsBatches.Add(NextJoinChannelsBatchId++, MoveTemp(Batch));
+
+	// Every join runs its own token request and connect, so the batch takes about as long as its slowest channel
+	for (const FString& ChannelName : UniqueChannelNames)
+	{
+		JoinChannel(ChannelName);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::CompleteChannelJoin(const FString& ChannelName, bool bSuccess)
+{
+	FPendingJoin PendingJoin;
+	if (PendingJoins.RemoveAndCopyValue(ChannelName, PendingJoin))
+	{
+		for (const FAccelByteVivoxOperationHandle Operation : PendingJoin.Operations)
+		{
+			JoinOperations.Remove(Operation);
+		}
+
+		if (bSuccess)
+		{
+			RecordLatency(EAccelByteVivoxLatencyStage::Join, FPlatformTime::Seconds() - PendingJoin.StartedAt);
+		}
+	}
+
+	ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Join %s %s"), *ChannelName, bSuccess ? TEXT("succeeded") : TEXT("failed"));
+	PositionalJoins.Remove(ChannelName);
+	StandbyJoins.Remove(ChannelName);
+	OnChannelJoined.Broadcast(ChannelName, bSuccess);
+	HandleChannelRejoinResult(ChannelName, bSuccess);
+	HandleChannelSwitchJoinResult(ChannelName, bSuccess);
+
+	TArray<FJoinChannelsBatch> CompletedBatches;
+	for (auto It = JoinChannelsBatches.CreateIterator(); It; ++It)
+	{
+		FJoinChannelsBatch& Batch = It->Value;
+		if (Batch.PendingChannels.Remove(ChannelName) == 0)
+		{
+			continue;
+		}
+
+		Batch.Results.Add(ChannelName, bSuccess);
+		if (Batch.PendingChannels.Num() == 0)
+		{
+			CompletedBatches.Add(MoveTemp(Batch));
+			It.RemoveCurrent();
+		}
+	}
+
+	for (const FJoinChannelsBatch& Batch : CompletedBatches)
+	{
+		Batch.OnCompleted.ExecuteIfBound(Batch.Results);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::PrefetchJoinToken(const FString& ChannelName)
+{
+	if (CurrentLoginState != EVivoxLoginState::LoggedIn)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("PrefetchJoinToken: Not logged in"));
+		return;
+	}
+
+	if (!ApiClientPtr.IsValid())
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("PrefetchJoinToken: ApiClient is invalid"));
+		return;
+	}
+
+	PurgeExpiredJoinTokens();
+
+	if (ChannelHandlesByName.Contains(ChannelName) || PendingJoinTokens.Contains(ChannelName) || JoinTokenCache.Contains(ChannelName))
+	{
+		return;
+	}
+
+	RequestJoinToken(ChannelName, false);
+}
+
+void FAccelByteVivoxVoiceChat::RequestJoinToken(const FString& ChannelName, bool bJoinOnResponse)
+{
+	const uint32 RequestId = ++LastJoinTokenRequestId;
+
+	FPendingJoinToken& PendingJoinToken = PendingJoinTokens.Add(ChannelName);
+	PendingJoinToken.RequestId = RequestId;
+	PendingJoinToken.RequestedAt = FPlatformTime::Seconds();
+	PendingJoinToken.bJoinRequested = bJoinOnResponse;
+	PendingJoinToken.bPositional = bJoinOnResponse && PositionalJoins.Contains(ChannelName);
+
+	// Request join token from AccelByte
+	FAccelByteVivoxTokenRequest Request;
+	Request.Type = EAccelByteVivoxTokenType::Join;
+	Request.Username = Username;
+	Request.ChannelName = ChannelName;
+	Request.bPositional = PendingJoinToken.bPositional;
+
+	Backend->RequestToken(
+		ApiClientPtr,
+		Request,
+		FOnAccelByteVivoxTokenReceived::CreateLambda([this, ChannelName, RequestId](const FString& AccessToken, const FString& Uri)
+		{
+			FQueuedEvent Event;
+			Event.Type = EQueuedEventType::JoinTokenReceived;
+			Event.RequestId = RequestId;
+			Event.ChannelName = ChannelName;
+			Event.AccessToken = AccessToken;
+			Event.Uri = Uri;
+			EnqueueEvent(MoveTemp(Event));
+		}),
+		FOnAccelByteVivoxTokenFailed::CreateLambda([this, ChannelName, RequestId](int32 ErrorCode, const FString& ErrorMessage)
+		{
+			FQueuedEvent Event;
+			Event.Type = EQueuedEventType::JoinTokenFailed;
+			Event.RequestId = RequestId;
+			Event.ChannelName = ChannelName;
+			Event.Error = ErrorCode;
+			Event.ErrorMessage = ErrorMessage;
+			EnqueueEvent(MoveTemp(Event));
+		})
+	);
+}
+
+void FAccelByteVivoxVoiceChat::HandleJoinTokenReceived(const FString& ChannelName, uint32 RequestId, const FString& AccessToken, const FString& Uri)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleJoinTokenReceived);
+	const FPendingJoinToken* PendingEntry = PendingJoinTokens.Find(ChannelName);
+	if (PendingEntry == nullptr || PendingEntry->RequestId != RequestId)
+	{
+		// Dropped by Logout or a cancelled join, or superseded by a newer request, while the request was in flight
+		return;
+	}
+
+	FPendingJoinToken PendingJoinToken;
+	PendingJoinTokens.RemoveAndCopyValue(ChannelName, PendingJoinToken);
+	RecordLatency(EAccelByteVivoxLatencyStage::JoinToken, FPlatformTime::Seconds() - PendingJoinToken.RequestedAt);
+
+	if (PendingJoinToken.bJoinRequested)
+	{
+		HandleJoinTokenResponse(ChannelName, AccessToken, Uri);
+		return;
+	}
+
+	const UAccelByteVivoxSettings* Settings = UAccelByteVivoxSettings::Get();
+
+	FCachedJoinToken& CachedJoinToken = JoinTokenCache.Add(ChannelName);
+	CachedJoinToken.AccessToken = AccessToken;
+	CachedJoinToken.Uri = Uri;
+	CachedJoinToken.ExpiresAt = FPlatformTime::Seconds() + Settings->JoinTokenCacheLifetimeSeconds;
+	CachedJoinToken.bPositional = PendingJoinToken.bPositional;
+
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Prefetched join token for channel %s"), *ChannelName);
+}
+
+void FAccelByteVivoxVoiceChat::HandleJoinTokenFailed(const FString& ChannelName, uint32 RequestId, int32 ErrorCode, const FString& ErrorMessage)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleJoinTokenFailed);
+	const FPendingJoinToken* PendingEntry = PendingJoinTokens.Find(ChannelName);
+	if (PendingEntry == nullptr || PendingEntry->RequestId != RequestId)
+	{
+		return;
+	}
+
+	FPendingJoinToken PendingJoinToken;
+	PendingJoinTokens.RemoveAndCopyValue(ChannelName, PendingJoinToken);
+
+	UE_LOG(LogAccelByteVivox, Error, TEXT("Failed to get join token for channel %s. Code: %d, Message: %s"),
+		*ChannelName, ErrorCode, *ErrorMessage);
+
+	if (PendingJoinToken.bJoinRequested)
+	{
+		CompleteChannelJoin(ChannelName, false);
+	}
+}
+
+bool FAccelByteVivoxVoiceChat::ConsumeCachedJoinToken(const FString& ChannelName, bool bPositional, FString& OutAccessToken, FString& OutUri)
+{
+	FCachedJoinToken CachedJoinToken;
+	if (!JoinTokenCache.RemoveAndCopyValue(ChannelName, CachedJoinToken))
+	{
+		return false;
+	}
+
+	// Tokens are single use, so the entry is dropped whether or not it is still valid
+	if (CachedJoinToken.ExpiresAt <= FPlatformTime::Seconds() || CachedJoinToken.bPositional != bPositional)
+	{
+		return false;
+	}
+
+	OutAccessToken = MoveTemp(CachedJoinToken.AccessToken);
+	OutUri = MoveTemp(CachedJoinToken.Uri);
+	return true;
+}
+
+void FAccelByteVivoxVoiceChat::PurgeExpiredJoinTokens()
+{
+	const double Now = FPlatformTime::Seconds();
+	for (auto It = JoinTokenCache.CreateIterator(); It; ++It)
+	{
+		if (It->Value.ExpiresAt <= Now)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool FAccelByteVivoxVoiceChat::CancelJoinBeforeConnect(const FString& ChannelName)
+{
+	if (!PendingJoins.Contains(ChannelName) || ChannelHandlesByName.Contains(ChannelName))
+	{
+		return false;
+	}
+
+	// Its token response is ignored on arrival, so no channel session is created and nothing connects
+	PendingJoinTokens.Remove(ChannelName);
+	++CancellationStats.Cancelled;
+	++CancellationStats.SkippedConnects;
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Join of channel %s cancelled before its token arrived"), *ChannelName);
+	CompleteChannelJoin(ChannelName, false);
+	return true;
+}
+
+void FAccelByteVivoxVoiceChat::DropJoinTokens()
+{
+	// Join tokens are bound to the logged in user, so drop them along with any responses still in flight
+	TArray<FString> WaitingChannelNames;
+	for (const TPair<FString, FPendingJoinToken>& Pair : PendingJoinTokens)
+	{
+		if (Pair.Value.bJoinRequested)
+		{
+			WaitingChannelNames.Add(Pair.Key);
+		}
+	}
+
+	JoinTokenCache.Empty();
+	PendingJoinTokens.Empty();
+
+	for (const FString& ChannelName : WaitingChannelNames)
+	{
+		CompleteChannelJoin(ChannelName, false);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::HandleJoinTokenResponse(const FString& ChannelName, const FString& AccessToken, const FString& Uri)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleJoinTokenResponse);
+	if (CurrentLoginState != EVivoxLoginState::LoggedIn)
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("Join channel failed: Not logged in"));
+		CompleteChannelJoin(ChannelName, false);
+		return;
+	}
+
+	if (Uri.IsEmpty())
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("Join channel failed: server URI missing in token response."));
+		CompleteChannelJoin(ChannelName, false);
+		return;
+	}
+
+	if (const FAccelByteVivoxChannelHandle* ExistingChannel = ChannelHandlesByName.Find(ChannelName))
+	{
+		// Only one session per channel; a second one would register a second set of participant handlers
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("Join channel: Channel %s already has a session, dropping the extra token"), *ChannelName);
+
+		// The join waiting on this token ends with the session that is already there. A session still connecting
+		// resolves it from its own connect completion, so completing it here too would report it twice.
+		const FChannelState* ExistingChannelState = Channels.Find(*ExistingChannel);
+		if (ExistingChannelState != nullptr && ExistingChannelState->bConnected && !ExistingChannelState->bLeaveRequested)
+		{
+			CompleteChannelJoin(ChannelName, true);
+		}
+		else if (ExistingChannelState == nullptr || ExistingChannelState->bLeaveRequested)
+		{
+			CompleteChannelJoin(ChannelName, false);
+		}
+		return;
+	}
+
+	const EAccelByteVivoxChannelPriority Priority = GetChannelPriority(ChannelName);
+	if (!MakeRoomForChannel(ChannelName, Priority))
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("Join channel failed: All %d channels in the budget outrank channel %s"),
+			MaxConcurrentChannels, *ChannelName);
+		CompleteChannelJoin(ChannelName, false);
+		return;
+	}
+
+	const UAccelByteVivoxSettings* Settings = UAccelByteVivoxSettings::Get();
+	const FTalkingHysteresis* Hysteresis = ChannelTalkingHysteresis.Find(ChannelName);
+
+	const FAccelByteVivoxChannelHandle Channel(++LastChannelHandle);
+	FChannelState& ChannelState = Channels.Add(Channel);
+	ChannelState.ChannelName = ChannelName;
+	ChannelState.Priority = Priority;
+	ChannelState.LastActiveAt = FPlatformTime::Seconds();
+	ChannelState.bStandby = StandbyJoins.Contains(ChannelName);
+	ChannelState.ConnectStartedAt = FPlatformTime::Seconds();
+	ChannelState.TalkingAttackSeconds = Hysteresis != nullptr ? Hysteresis->AttackSeconds : Settings->TalkingAttackSeconds;
+	ChannelState.TalkingReleaseSeconds = Hysteresis != nullptr ? Hysteresis->ReleaseSeconds : Settings->TalkingReleaseSeconds;
+	ChannelState.bSampleAudioEnergy = AudioEnergySubscriptions.Contains(ChannelName);
+	const FAccelByteVivoxPositionalProperties* PositionalProperties = PositionalJoins.Find(ChannelName);
+	if (PositionalProperties != nullptr)
+	{
+		ChannelState.bPositional = true;
+		ChannelState.PositionalProperties = *PositionalProperties;
+	}
+	ChannelHandlesByName.Add(ChannelName, Channel);
+
+	const int32 Error = Backend->BeginConnect(
+		Channel,
+		ChannelName,
+		AccessToken,
+		PositionalProperties,
+		FOnAccelByteVivoxBackendCompleted::CreateLambda([this, Channel, ChannelName](int32 ConnectError)
+		{
+			FQueuedEvent Event;
+			Event.Type = EQueuedEventType::ChannelConnectCompleted;
+			Event.Channel = Channel;
+			Event.ChannelName = ChannelName;
+			Event.Error = ConnectError;
+			EnqueueEvent(MoveTemp(Event));
+		}));
+
+	if (Error != IAccelByteVivoxBackend::Success)
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("BeginConnect failed for channel %s, error: %d"), *ChannelName, Error);
+		CleanUpChannelSession(Channel);
+		CompleteChannelJoin(ChannelName, false);
+		return;
+	}
+
+	if (Channels[Channel].bStandby)
+	{
+		// Silenced and left out of transmission before it connects, so it is never heard or heard from
+		Backend->SetChannelOutputMuted(Channel, true);
+		ApplyTransmission();
+	}
+}
+
+void FAccelByteVivoxVoiceChat::HandleChannelConnectCompleted(FAccelByteVivoxChannelHandle Channel, const FString& ChannelName, int32 Error)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleChannelConnectCompleted);
+	if (!Channels.Contains(Channel))
+	{
+		// Left, or cleaned up by LeaveAllChannels, while connecting; its join has already completed
+		return;
+	}
+
+	if (Error == IAccelByteVivoxBackend::Success && Channels[Channel].bLeaveRequested)
+	{
+		// Left while connecting; the disconnect that follows fails the join
+		return;
+	}
+
+	if (Error == IAccelByteVivoxBackend::Success)
+	{
+		FChannelState* ChannelState = Channels.Find(Channel);
+		double ConnectSeconds = 0.0;
+		if (ChannelState != nullptr)
+		{
+			ConnectSeconds = FPlatformTime::Seconds() - ChannelState->ConnectStartedAt;
+			RecordLatency(EAccelByteVivoxLatencyStage::ChannelConnect, ConnectSeconds);
+			ChannelState->bConnected = true;
+			// A new positional channel gets the current pose on the next tick rather than on the next movement
+			bListenerPoseDirty |= ChannelState->bPositional && bListenerPoseSet;
+		}
+
+		// Another active channel may change where transmission to all can go
+		if (HasStandbyChannels())
+		{
+			ApplyTransmission();
+		}
+
+		UE_LOG(LogAccelByteVivox, Log, TEXT("Joined channel: %s (connect %.3fs)"), *ChannelName, ConnectSeconds);
+		CompleteChannelJoin(ChannelName, true);
+	}
+	else
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("Failed to join channel %s, error: %d"), *ChannelName, Error);
+		CleanUpChannelSession(Channel);
+		CompleteChannelJoin(ChannelName, false);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::OnBackendChannelDisconnected(FAccelByteVivoxChannelHandle Channel)
+{
+	FQueuedEvent Event;
+	Event.Type = EQueuedEventType::ChannelDisconnected;
+	Event.Channel = Channel;
+	EnqueueEvent(MoveTemp(Event));
+}
+
+void FAccelByteVivoxVoiceChat::HandleChannelDisconnected(FAccelByteVivoxChannelHandle Channel)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleChannelDisconnected);
+	const FChannelState* ChannelState = Channels.Find(Channel);
+	if (ChannelState == nullptr)
+	{
+		return;
+	}
+
+	const FString ChannelName = ChannelState->ChannelName;
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Channel %s disconnected"), *ChannelName);
+	ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Channel %s disconnected"), *ChannelName);
+
+	if (!ChannelState->bLeaveRequested && CurrentLoginState == EVivoxLoginState::LoggedIn
+		&& UAccelByteVivoxSettings::Get()->bAutoReconnect)
+	{
+		BeginChannelRejoin(*ChannelState, FPlatformTime::Seconds());
+	}
+
+	const bool bJoinPending = !ChannelState->bConnected && PendingJoins.Contains(ChannelName);
+	CleanUpChannelSession(Channel);
+	if (bJoinPending)
+	{
+		// Disconnected before the connect finished, so the join failed
+		CompleteChannelJoin(ChannelName, false);
+	}
+	OnChannelLeft.Broadcast(ChannelName);
+
+	// A switch away from this channel is done now that it is left
+	if (ChannelSwitches.Num() > 0)
+	{
+		CompleteLeftChannelSwitches();
+	}
+}
+
+void FAccelByteVivoxVoiceChat::BeginChannelRejoin(const FChannelState& ChannelState, double LostAt)
+{
+	FChannelRejoin& Rejoin = ChannelRejoins.Add(ChannelState.ChannelName);
+	Rejoin.LostAt = LostAt;
+	Rejoin.bPositional = ChannelState.bPositional;
+	Rejoin.PositionalProperties = ChannelState.PositionalProperties;
+	Rejoin.bStandby = ChannelState.bStandby;
+	Rejoin.MutedPlayers = ChannelState.MutesToRestore;
+	for (TConstSetBitIterator<> It(ChannelState.Muted); It; ++It)
+	{
+		Rejoin.MutedPlayers.Add(ChannelState.ParticipantIds[It.GetIndex()]);
+	}
+
+	if (!ScheduleReconnectAttempt(ChannelState.ChannelName, Rejoin.Attempt, Rejoin.NextAttemptAt))
+	{
+		ChannelRejoins.Remove(ChannelState.ChannelName);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::RestorePlayerMutes(FChannelState& ChannelState)
+{
+	for (int32 Slot = 0; Slot < ChannelState.Num() && ChannelState.MutesToRestore.Num() > 0; ++Slot)
+	{
+		if (ChannelState.MutesToRestore.Remove(ChannelState.ParticipantIds[Slot]) > 0)
+		{
+			SetPlayerMute(ChannelState.ChannelName, ChannelState.ParticipantIds[Slot], true);
+		}
+	}
+}
+
+void FAccelByteVivoxVoiceChat::CleanUpChannelSession(FAccelByteVivoxChannelHandle Channel)
+{
+	Backend->ReleaseChannel(Channel);
+
+	FChannelState ChannelState;
+	if (Channels.RemoveAndCopyValue(Channel, ChannelState))
+	{
+		// The name may already point at a newer session for the same channel
+		if (ChannelHandlesByName.FindRef(ChannelState.ChannelName) == Channel)
+		{
+			ChannelHandlesByName.Remove(ChannelState.ChannelName);
+		}
+
+		for (const FString& ParticipantId : ChannelState.ParticipantIds)
+		{
+			RemovePlayerChannel(ParticipantId, Channel);
+		}
+
+		if (CurrentLoginState == EVivoxLoginState::LoggedIn && (ChannelState.bStandby || HasStandbyChannels()))
+		{
+			ApplyTransmission();
+		}
+	}
+}
+
+void FAccelByteVivoxVoiceChat::LeaveChannel(const FString& ChannelName)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(LeaveChannel);
+	// Stop restoring a channel the game no longer wants
+	FChannelRejoin* Rejoin = ChannelRejoins.Find(ChannelName);
+	if (Rejoin != nullptr)
+	{
+		if (!Rejoin->bInFlight)
+		{
+			ChannelRejoins.Remove(ChannelName);
+			CompleteLoginRecoveryIfDone();
+			return;
+		}
+		Rejoin->bCancelled = true;
+	}
+
+	const FAccelByteVivoxChannelHandle Channel = GetChannelHandle(ChannelName);
+	if (!Channel.IsValid())
+	{
+		// A join still waiting on its token is stopped here rather than connected and then torn down
+		if (!CancelJoinBeforeConnect(ChannelName) && Rejoin == nullptr)
+		{
+			UE_LOG(LogAccelByteVivox, Warning, TEXT("LeaveChannel: Not in channel %s"), *ChannelName);
+		}
+		return;
+	}
+
+	Channels[Channel].bLeaveRequested = true;
+	Backend->Disconnect(Channel);
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Leaving channel: %s"), *ChannelName);
+	ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Leave %s"), *ChannelName);
+	// Cleanup will happen in HandleChannelDisconnected when disconnect completes
+}
+
+void FAccelByteVivoxVoiceChat::LeaveAllChannels()
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(LeaveAllChannels);
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	for (const TPair<FAccelByteVivoxChannelHandle, FChannelState>& Pair : Channels)
+	{
+		Backend->Disconnect(Pair.Key);
+	}
+
+	// Force cleanup in case disconnect callbacks don't fire (e.g., during shutdown)
+	TArray<FString> ConnectingChannelNames;
+	for (const TPair<FAccelByteVivoxChannelHandle, FChannelState>& Pair : Channels)
+	{
+		Backend->ReleaseChannel(Pair.Key);
+		if (!Pair.Value.bConnected && PendingJoins.Contains(Pair.Value.ChannelName))
+		{
+			ConnectingChannelNames.Add(Pair.Value.ChannelName);
+		}
+	}
+	Channels.Empty();
+	ChannelHandlesByName.Empty();
+	PlayerChannels.Empty();
+	ChannelRejoins.Empty();
+
+	// Their connect completions will be ignored, so resolve the joins waiting on them now
+	for (const FString& ChannelName : ConnectingChannelNames)
+	{
+		CompleteChannelJoin(ChannelName, false);
+	}
+
+	// Joins still waiting on their tokens would otherwise connect after everything was left
+	TArray<FString> WaitingChannelNames;
+	PendingJoins.GetKeys(WaitingChannelNames);
+	for (const FString& ChannelName : WaitingChannelNames)
+	{
+		CancelJoinBeforeConnect(ChannelName);
+	}
+	CompleteLoginRecoveryIfDone();
+}
+
+bool FAccelByteVivoxVoiceChat::IsJoiningChannel(const FString& ChannelName) const
+{
+	return PendingJoins.Contains(ChannelName);
+}
+
+bool FAccelByteVivoxVoiceChat::IsInChannel(const FString& ChannelName) const
+{
+	return ChannelHandlesByName.Contains(ChannelName);
+}
+
+void FAccelByteVivoxVoiceChat::SwitchChannel(const FString& FromChannelName, const FString& ToChannelName,
+	const FOnVivoxSwitchChannelCompleted& OnCompleted)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(SwitchChannel);
+	if (CurrentLoginState != EVivoxLoginState::LoggedIn)
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("SwitchChannel failed: Not logged in"));
+		OnCompleted.ExecuteIfBound(false);
+		return;
+	}
+
+	if (FromChannelName == ToChannelName)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("SwitchChannel: Already in channel %s"), *ToChannelName);
+		OnCompleted.ExecuteIfBound(IsInChannel(ToChannelName));
+		return;
+	}
+
+	FChannelSwitch Switch;
+	Switch.FromChannelName = FromChannelName;
+	Switch.ToChannelName = ToChannelName;
+	Switch.OnCompleted = OnCompleted;
+	ChannelSwitches.Add(MoveTemp(Switch));
+
+	FChannelState* FromChannelState = Channels.Find(GetChannelHandle(FromChannelName));
+	if (FromChannelState != nullptr)
+	{
+		FromChannelState->bSwitchingAway = true;
+	}
+
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Switching from channel %s to %s"), *FromChannelName, *ToChannelName);
+	ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Switch %s -> %s"), *FromChannelName, *ToChannelName);
+	if (IsInChannel(ToChannelName))
+	{
+		HandleChannelSwitchJoinResult(ToChannelName, true);
+	}
+	else
+	{
+		JoinChannel(ToChannelName);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::HandleChannelSwitchJoinResult(const FString& ChannelName, bool bSuccess)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleChannelSwitchJoinResult);
+	const double LeaveFromAt = FPlatformTime::Seconds() + UAccelByteVivoxSettings::Get()->ChannelSwitchOverlapSeconds;
+
+	TArray<FChannelSwitch> FailedSwitches;
+	TArray<FString> TransmissionFromChannelNames;
+	for (int32 Index = 0; Index < ChannelSwitches.Num(); ++Index)
+	{
+		FChannelSwitch& Switch = ChannelSwitches[Index];
+		if (Switch.bJoined || Switch.ToChannelName != ChannelName)
+		{
+			continue;
+		}
+
+		if (bSuccess)
+		{
+			Switch.bJoined = true;
+			Switch.LeaveFromAt = LeaveFromAt;
+			TransmissionFromChannelNames.Add(Switch.FromChannelName);
+			continue;
+		}
+
+		FChannelState* FromChannelState = Channels.Find(GetChannelHandle(Switch.FromChannelName));
+		if (FromChannelState != nullptr)
+		{
+			FromChannelState->bSwitchingAway = false;
+		}
+		FailedSwitches.Add(MoveTemp(Switch));
+		ChannelSwitches.RemoveAt(Index--);
+	}
+
+	if (TransmissionFromChannelNames.Num() > 0)
+	{
+		if (IsStandbyChannel(ChannelName))
+		{
+			PromoteStandbyChannel(ChannelName, false);
+		}
+
+		// Transmission follows the switch only if it was going to the channel being left
+		if (TransmissionMode == ETransmissionMode::Default
+			|| (TransmissionMode == ETransmissionMode::Channel && TransmissionFromChannelNames.Contains(TransmissionChannelName)))
+		{
+			SetTransmissionChannel(ChannelName);
+		}
+	}
+
+	for (const FChannelSwitch& Switch : FailedSwitches)
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("SwitchChannel failed: Could not join channel %s, staying in %s"),
+			*Switch.ToChannelName, *Switch.FromChannelName);
+		Switch.OnCompleted.ExecuteIfBound(false);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::UpdateChannelSwitches()
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(UpdateChannelSwitches);
+	if (ChannelSwitches.Num() == 0)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	TArray<FString> FromChannelNames;
+	for (FChannelSwitch& Switch : ChannelSwitches)
+	{
+		if (Switch.bJoined && !Switch.bLeaveFromRequested && Now >= Switch.LeaveFromAt)
+		{
+			Switch.bLeaveFromRequested = true;
+			FromChannelNames.AddUnique(Switch.FromChannelName);
+		}
+	}
+
+	for (const FString& FromChannelName : FromChannelNames)
+	{
+		// The game may have left it during the overlap
+		if (IsInChannel(FromChannelName))
+		{
+			LeaveChannel(FromChannelName);
+		}
+	}
+
+	// Catches a From channel that was already gone, or that went without a disconnect, e.g. through LeaveAllChannels
+	CompleteLeftChannelSwitches();
+}
+
+void FAccelByteVivoxVoiceChat::CompleteLeftChannelSwitches()
+{
+	TArray<FChannelSwitch> CompletedSwitches;
+	for (int32 Index = 0; Index < ChannelSwitches.Num(); ++Index)
+	{
+		if (ChannelSwitches[Index].bLeaveFromRequested && !IsInChannel(ChannelSwitches[Index].FromChannelName))
+		{
+			CompletedSwitches.Add(MoveTemp(ChannelSwitches[Index]));
+			ChannelSwitches.RemoveAt(Index--);
+		}
+	}
+
+	for (const FChannelSwitch& Switch : CompletedSwitches)
+	{
+		UE_LOG(LogAccelByteVivox, Log, TEXT("Switched from channel %s to %s"), *Switch.FromChannelName, *Switch.ToChannelName);
+		Switch.OnCompleted.ExecuteIfBound(true);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::SetChannelPriority(const FString& ChannelName, EAccelByteVivoxChannelPriority Priority)
+{
+	if (Priority == EAccelByteVivoxChannelPriority::Normal)
+	{
+		ChannelPriorities.Remove(ChannelName);
+	}
+	else
+	{
+		ChannelPriorities.Add(ChannelName, Priority);
+	}
+
+	FChannelState* ChannelState = Channels.Find(GetChannelHandle(ChannelName));
+	if (ChannelState != nullptr)
+	{
+		ChannelState->Priority = Priority;
+	}
+}
+
+EAccelByteVivoxChannelPriority FAccelByteVivoxVoiceChat::GetChannelPriority(const FString& ChannelName) const
+{
+	const EAccelByteVivoxChannelPriority* Priority = ChannelPriorities.Find(ChannelName);
+	return Priority != nullptr ? *Priority : EAccelByteVivoxChannelPriority::Normal;
+}
+
+void FAccelByteVivoxVoiceChat::SetMaxConcurrentChannels(int32 MaxChannels)
+{
+	MaxConcurrentChannels = FMath::Max(MaxChannels, 0);
+
+	while (MaxConcurrentChannels > 0 && GetBudgetedChannelCount() > MaxConcurrentChannels)
+	{
+		const FAccelByteVivoxChannelHandle Channel = FindChannelToEvict(EAccelByteVivoxChannelPriority::High);
+		if (!Channel.IsValid())
+		{
+			// The rest are still connecting; joins stay blocked until enough of them leave
+			break;
+		}
+		EvictChannel(Channel, FString());
+	}
+}
+
+int32 FAccelByteVivoxVoiceChat::GetMaxConcurrentChannels() const
+{
+	return MaxConcurrentChannels;
+}
+
+int32 FAccelByteVivoxVoiceChat::GetBudgetedChannelCount() const
+{
+	// A channel that is being left, or switched away from, no longer takes part in the budget
+	int32 Count = 0;
+	for (const TPair<FAccelByteVivoxChannelHandle, FChannelState>& Pair : Channels)
+	{
+		Count += Pair.Value.bLeaveRequested || Pair.Value.bSwitchingAway ? 0 : 1;
+	}
+	return Count;
+}
+
+FAccelByteVivoxChannelHandle FAccelByteVivoxVoiceChat::FindChannelToEvict(EAccelByteVivoxChannelPriority MaxPriority) const
+{
+	const double Now = FPlatformTime::Seconds();
+
+	FAccelByteVivoxChannelHandle Candidate;
+	EAccelByteVivoxChannelPriority CandidatePriority = MaxPriority;
+	double CandidateActiveAt = 0.0;
+	for (const TPair<FAccelByteVivoxChannelHandle, FChannelState>& Pair : Channels)
+	{
+		const FChannelState& ChannelState = Pair.Value;
+		// Channels still connecting are left alone, so a join never cancels another one in progress
+		if (!ChannelState.bConnected || ChannelState.bLeaveRequested || ChannelState.bSwitchingAway || ChannelState.Priority > MaxPriority)
+		{
+			continue;
+		}
+
+		// The channel receiving the microphone is in use right now
+		const bool bTransmitting = TransmissionMode == ETransmissionMode::Channel && TransmissionChannelName == ChannelState.ChannelName;
+		const double ActiveAt = bTransmitting ? Now : ChannelState.LastActiveAt;
+		if (!Candidate.IsValid() || ChannelState.Priority < CandidatePriority
+			|| (ChannelState.Priority == CandidatePriority && ActiveAt < CandidateActiveAt))
+		{
+			Candidate = Pair.Key;
+			CandidatePriority = ChannelState.Priority;
+			CandidateActiveAt = ActiveAt;
+		}
+	}
+	return Candidate;
+}
+
+bool FAccelByteVivoxVoiceChat::MakeRoomForChannel(const FString& ChannelName, EAccelByteVivoxChannelPriority MaxPriority)
+{
+	while (MaxConcurrentChannels > 0 && GetBudgetedChannelCount() >= MaxConcurrentChannels)
+	{
+		const FAccelByteVivoxChannelHandle Channel = FindChannelToEvict(MaxPriority);
+		if (!Channel.IsValid())
+		{
+			return false;
+		}
+		EvictChannel(Channel, ChannelName);
+	}
+	return true;
+}
+
+void FAccelByteVivoxVoiceChat::EvictChannel(FAccelByteVivoxChannelHandle Channel, const FString& JoiningChannelName)
+{
+	const FString ChannelName = Channels[Channel].ChannelName;
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Evicting channel %s to stay within the budget of %d channels"), *ChannelName, MaxConcurrentChannels);
+	ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Evict %s"), *ChannelName);
+
+	LeaveChannel(ChannelName);
+	OnChannelEvicted.Broadcast(ChannelName, JoiningChannelName);
+}
+
+void FAccelByteVivoxVoiceChat::MarkTransmissionChannelActive()
+{
+	if (TransmissionMode != ETransmissionMode::Channel)
+	{
+		return;
+	}
+
+	FChannelState* ChannelState = Channels.Find(GetChannelHandle(TransmissionChannelName));
+	if (ChannelState != nullptr)
+	{
+		ChannelState->LastActiveAt = FPlatformTime::Seconds();
+	}
+}
+
+FAccelByteVivoxOperationHandle FAccelByteVivoxVoiceChat::JoinPositionalChannel(const FString& ChannelName, const FAccelByteVivoxPositionalProperties& Properties)
+{
+	if (PendingJoins.Contains(ChannelName))
+	{
+		// The join in flight may already have asked for a token of the other kind, so it keeps its own properties
+		if (!PositionalJoins.Contains(ChannelName))
+		{
+			UE_LOG(LogAccelByteVivox, Warning, TEXT("JoinPositionalChannel: Channel %s is already being joined as a non-positional channel"),
+				*ChannelName);
+		}
+	}
+	else if (!ChannelHandlesByName.Contains(ChannelName))
+	{
+		PositionalJoins.Add(ChannelName, Properties);
+	}
+
+	return JoinChannel(ChannelName);
+}
+
+FAccelByteVivoxOperationHandle FAccelByteVivoxVoiceChat::JoinStandbyChannel(const FString& ChannelName)
+{
+	if (PendingJoins.Contains(ChannelName))
+	{
+		// The join in flight keeps the mode it was started with, as for positional joins
+		if (!StandbyJoins.Contains(ChannelName))
+		{
+			UE_LOG(LogAccelByteVivox, Warning, TEXT("JoinStandbyChannel: Channel %s is already being joined as an active channel"),
+				*ChannelName);
+		}
+	}
+	else if (ChannelHandlesByName.Contains(ChannelName))
+	{
+		DemoteToStandby(ChannelName);
+	}
+	else
+	{
+		StandbyJoins.Add(ChannelName);
+	}
+
+	return JoinChannel(ChannelName);
+}
+
+void FAccelByteVivoxVoiceChat::PromoteStandbyChannel(const FString& ChannelName, bool bSetTransmission)
+{
+	const FAccelByteVivoxChannelHandle Channel = GetChannelHandle(ChannelName);
+	FChannelState* ChannelState = Channels.Find(Channel);
+	if (ChannelState == nullptr || !ChannelState->bStandby)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("PromoteStandbyChannel: Channel %s is not on standby"), *ChannelName);
+		return;
+	}
+
+	ChannelState->bStandby = false;
+	ChannelState->LastActiveAt = FPlatformTime::Seconds();
+	Backend->SetChannelOutputMuted(Channel, false);
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Promoted standby channel: %s"), *ChannelName);
+	ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Promote %s"), *ChannelName);
+
+	if (bSetTransmission && CurrentLoginState != EVivoxLoginState::NotLoggedIn)
+	{
+		SetTransmissionChannel(ChannelName);
+	}
+	else
+	{
+		ApplyTransmission();
+	}
+}
+
+void FAccelByteVivoxVoiceChat::DemoteToStandby(const FString& ChannelName)
+{
+	const FAccelByteVivoxChannelHandle Channel = GetChannelHandle(ChannelName);
+	FChannelState* ChannelState = Channels.Find(Channel);
+	if (ChannelState == nullptr)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("DemoteToStandby: Not in channel %s"), *ChannelName);
+		return;
+	}
+
+	if (ChannelState->bStandby)
+	{
+		return;
+	}
+
+	ChannelState->bStandby = true;
+	Backend->SetChannelOutputMuted(Channel, true);
+	ApplyTransmission();
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Channel %s on standby"), *ChannelName);
+	ACCELBYTEVIVOX_TRACE_BOOKMARK(TEXT("AccelByteVivox: Standby %s"), *ChannelName);
+}
+
+bool FAccelByteVivoxVoiceChat::IsStandbyChannel(const FString& ChannelName) const
+{
+	const FChannelState* ChannelState = Channels.Find(GetChannelHandle(ChannelName));
+	return ChannelState != nullptr && ChannelState->bStandby;
+}
+
+bool FAccelByteVivoxVoiceChat::HasStandbyChannels() const
+{
+	for (const TPair<FAccelByteVivoxChannelHandle, FChannelState>& Pair : Channels)
+	{
+		if (Pair.Value.bStandby)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FAccelByteVivoxVoiceChat::ApplyTransmission()
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(ApplyTransmission);
+	if (TransmissionMode == ETransmissionMode::None)
+	{
+		Backend->SetTransmissionToNone();
+		return;
+	}
+
+	if (TransmissionMode == ETransmissionMode::Channel)
+	{
+		// Demoting the transmission channel keeps it as the target, and promoting it again resumes transmission
+		const FAccelByteVivoxChannelHandle Channel = GetChannelHandle(TransmissionChannelName);
+		const FChannelState* ChannelState = Channels.Find(Channel);
+		if (ChannelState != nullptr && !ChannelState->bStandby)
+		{
+			Backend->SetTransmissionChannel(Channel);
+		}
+		else
+		{
+			Backend->SetTransmissionToNone();
+		}
+		return;
+	}
+
+	if (!HasStandbyChannels())
+	{
+		Backend->SetTransmissionToAll();
+		return;
+	}
+
+	FAccelByteVivoxChannelHandle ActiveChannel;
+	int32 ActiveChannelCount = 0;
+	for (const TPair<FAccelByteVivoxChannelHandle, FChannelState>& Pair : Channels)
+	{
+		if (!Pair.Value.bStandby && !Pair.Value.bLeaveRequested)
+		{
+			ActiveChannel = Pair.Key;
+			++ActiveChannelCount;
+		}
+	}
+
+	if (ActiveChannelCount == 1)
+	{
+		Backend->SetTransmissionChannel(ActiveChannel);
+		return;
+	}
+
+	if (ActiveChannelCount > 1)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("Not transmitting: Cannot transmit to all %d active channels without the standby ones"),
+			ActiveChannelCount);
+	}
+	Backend->SetTransmissionToNone();
+}
+
+bool FAccelByteVivoxVoiceChat::IsPositionalChannel(const FString& ChannelName) const
+{
+	const FChannelState* ChannelState = Channels.Find(GetChannelHandle(ChannelName));
+	return ChannelState != nullptr && ChannelState->bPositional;
+}
+
+void FAccelByteVivoxVoiceChat::Set3DPosition(const FVector& SpeakerPosition, const FVector& ListenerPosition, const FVector& ListenerForward,
+	const FVector& ListenerUp)
+{
+	++PositionUpdateStats.Requested;
+
+	ListenerPose.SpeakerPosition = SpeakerPosition;
+	ListenerPose.ListenerPosition = ListenerPosition;
+	ListenerPose.ListenerForward = ListenerForward.IsNearlyZero() ? FVector::ForwardVector : ListenerForward.GetSafeNormal();
+	ListenerPose.ListenerUp = ListenerUp.IsNearlyZero() ? FVector::UpVector : ListenerUp.GetSafeNormal();
+	bListenerPoseSet = true;
+	bListenerPoseDirty = true;
+}
+
+void FAccelByteVivoxVoiceChat::Set3DPosition(const FVector& Position, const FRotator& Rotation)
+{
+	const FRotationMatrix RotationMatrix(Rotation);
+	Set3DPosition(Position, Position, RotationMatrix.GetUnitAxis(EAxis::X), RotationMatrix.GetUnitAxis(EAxis::Z));
+}
+
+FAccelByteVivoxPositionUpdateStats FAccelByteVivoxVoiceChat::GetPositionUpdateStats() const
+{
+	return PositionUpdateStats;
+}
+
+bool FAccelByteVivoxVoiceChat::HasPoseChanged(const FListenerPose& SentPose, const FListenerPose& Pose)
+{
+	const UAccelByteVivoxSettings* Settings = UAccelByteVivoxSettings::Get();
+
+	const float DistanceThresholdSquared = FMath::Square(Settings->PositionUpdateDistanceThreshold);
+	if (FVector::DistSquared(SentPose.ListenerPosition, Pose.ListenerPosition) > DistanceThresholdSquared
+		|| FVector::DistSquared(SentPose.SpeakerPosition, Pose.SpeakerPosition) > DistanceThresholdSquared)
+	{
+		return true;
+	}
+
+	// Both orientation vectors are unit length, so the cosine of the angle between old and new is their dot product
+	const float MinCosine = FMath::Cos(FMath::DegreesToRadians(Settings->PositionUpdateAngleThresholdDegrees));
+	return (SentPose.ListenerForward != Pose.ListenerForward && FVector::DotProduct(SentPose.ListenerForward, Pose.ListenerForward) < MinCosine)
+		|| (SentPose.ListenerUp != Pose.ListenerUp && FVector::DotProduct(SentPose.ListenerUp, Pose.ListenerUp) < MinCosine);
+}
+
+void FAccelByteVivoxVoiceChat::UpdatePositions()
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(UpdatePositions);
+	if (!bListenerPoseDirty)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const double MinInterval = 1.0 / FMath::Max(UAccelByteVivoxSettings::Get()->PositionUpdateRateHz, 1.0f);
+
+	// Stays set while any channel holds back a pose for the rate limit, so it is sent once the interval is up
+	bool bPosePending = false;
+	for (TPair<FAccelByteVivoxChannelHandle, FChannelState>& Pair : Channels)
+	{
+		FChannelState& ChannelState = Pair.Value;
+		if (!ChannelState.bPositional || !ChannelState.bConnected)
+		{
+			continue;
+		}
+
+		if (ChannelState.bPoseSent && !HasPoseChanged(ChannelState.SentPose, ListenerPose))
+		{
+			continue;
+		}
+
+		if (Now < ChannelState.PoseSentAt + MinInterval)
+		{
+			bPosePending = true;
+			continue;
+		}
+
+		// Failures are retried at the same rate as updates
+		ChannelState.PoseSentAt = Now;
+		const int32 Error = Backend->Set3DPosition(Pair.Key, ListenerPose.SpeakerPosition, ListenerPose.ListenerPosition,
+			ListenerPose.ListenerForward, ListenerPose.ListenerUp);
+		if (Error != IAccelByteVivoxBackend::Success)
+		{
+			UE_LOG(LogAccelByteVivox, Warning, TEXT("Set3DPosition failed for channel %s, error: %d"), *ChannelState.ChannelName, Error);
+			bPosePending = true;
+			continue;
+		}
+
+		ChannelState.bPoseSent = true;
+		ChannelState.SentPose = ListenerPose;
+		++PositionUpdateStats.Sent;
+	}
+
+	bListenerPoseDirty = bPosePending;
+}
+
+void FAccelByteVivoxVoiceChat::SetTransmissionChannel(const FString& ChannelName)
+{
+	if (CurrentLoginState == EVivoxLoginState::NotLoggedIn)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetTransmissionChannel: Not logged in"));
+		return;
+	}
+
+	const FAccelByteVivoxChannelHandle Channel = GetChannelHandle(ChannelName);
+	if (!Channel.IsValid())
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetTransmissionChannel: Not in channel %s"), *ChannelName);
+		return;
+	}
+
+	if (Channels[Channel].bStandby)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetTransmissionChannel: Channel %s is on standby, promote it first"), *ChannelName);
+		return;
+	}
+
+	MarkTransmissionChannelActive();
+	Backend->SetTransmissionChannel(Channel);
+	TransmissionMode = ETransmissionMode::Channel;
+	TransmissionChannelName = ChannelName;
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Transmission set to channel: %s"), *ChannelName);
+}
+
+void FAccelByteVivoxVoiceChat::SetTransmissionToAll()
+{
+	if (CurrentLoginState == EVivoxLoginState::NotLoggedIn)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetTransmissionToAll: Not logged in"));
+		return;
+	}
+
+	MarkTransmissionChannelActive();
+	TransmissionMode = ETransmissionMode::All;
+	ApplyTransmission();
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Transmission set to all channels"));
+}
+
+void FAccelByteVivoxVoiceChat::SetTransmissionToNone()
+{
+	if (CurrentLoginState == EVivoxLoginState::NotLoggedIn)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetTransmissionToNone: Not logged in"));
+		return;
+	}
+
+	MarkTransmissionChannelActive();
+	Backend->SetTransmissionToNone();
+	TransmissionMode = ETransmissionMode::None;
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Transmission set to none"));
+}
+
+void FAccelByteVivoxVoiceChat::SetLocalMute(bool bMuted)
+{
+	if (!bInitialized)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetLocalMute: Vivox not initialized"));
+		return;
+	}
+
+	bLocalMuted = bMuted;
+	Backend->SetInputMuted(bMuted);
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Local mute set to: %s"), bMuted ? TEXT("true") : TEXT("false"));
+}
+
+bool FAccelByteVivoxVoiceChat::IsLocalMuted() const
+{
+	return bLocalMuted;
+}
+
+void FAccelByteVivoxVoiceChat::SetPlayerMute(const FString& ChannelName, const FString& PlayerId, bool bMuted)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(SetPlayerMute);
+	const FAccelByteVivoxChannelHandle Channel = GetChannelHandle(ChannelName);
+	if (!Channel.IsValid())
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetPlayerMute: Not in channel %s"), *ChannelName);
+		return;
+	}
+
+	const FAccelByteVivoxParticipantHandle Participant = GetParticipantHandle(Channel, PlayerId);
+	if (!Participant.IsValid())
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetPlayerMute: Participant %s not found in channel %s"),
+			*PlayerId, *ChannelName);
+		return;
+	}
+
+	const int32 Error = BeginParticipantMute(Channel, Participant, PlayerId, bMuted, 0);
+	if (Error == IAccelByteVivoxBackend::ErrorNotFound)
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetPlayerMute: Participant %s not found in channel %s"),
+			*PlayerId, *ChannelName);
+	}
+	else if (Error != IAccelByteVivoxBackend::Success)
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("Failed to set mute for player %s, error: %d"), *PlayerId, Error);
+	}
+}
+
+int32 FAccelByteVivoxVoiceChat::BeginParticipantMute(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+	const FString& PlayerId, bool bMuted, uint32 BatchId)
+{
+	return Backend->BeginSetParticipantMute(Channel, Participant, bMuted,
+		FOnAccelByteVivoxBackendCompleted::CreateLambda(
+			[this, Channel, Participant, PlayerId, bMuted, BatchId](int32 MuteError)
+			{
+				FQueuedEvent Event;
+				Event.Type = EQueuedEventType::ParticipantMuteCompleted;
+				Event.Channel = Channel;
+				Event.Participant = Participant;
+				Event.ParticipantId = PlayerId;
+				Event.bValue = bMuted;
+				Event.Error = MuteError;
+				Event.RequestId = BatchId;
+				EnqueueEvent(MoveTemp(Event));
 			}));
-#endif
 }
 
-bool FAccelByteVivoxVoiceChat::IsPlayerMuted(const FString& ChannelName, const FString& PlayerId) const
+void FAccelByteVivoxVoiceChat::HandleParticipantMuteCompleted(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+	const FString& PlayerId, bool bMuted, int32 Error, uint32 BatchId)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleParticipantMuteCompleted);
+	if (Error != IAccelByteVivoxBackend::Success)
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("Failed to set mute for player %s, error: %d"), *PlayerId, Error);
+	}
+	else
+	{
+		FChannelState* ChannelState = Channels.Find(Channel);
+		const int32 Slot = ChannelState != nullptr ? ChannelState->FindSlot(Participant) : INDEX_NONE;
+		if (Slot != INDEX_NONE)
+		{
+			ChannelState->Muted[Slot] = bMuted;
+		}
+
+		UE_LOG(LogAccelByteVivox, Log, TEXT("Player %s mute set to %s"), *PlayerId, bMuted ? TEXT("true") : TEXT("false"));
+	}
+
+	if (BatchId != 0)
+	{
+		CompleteMuteBatchRequest(BatchId, PlayerId, Error == IAccelByteVivoxBackend::Success);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::SetPlayersMute(const FString& ChannelName, const TArray<FString>& PlayerIds, bool bMuted,
+	const FOnVivoxPlayersMuteCompleted& OnCompleted)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(SetPlayersMute);
+	const FAccelByteVivoxChannelHandle Channel = GetChannelHandle(ChannelName);
+	if (!Channel.IsValid())
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("SetPlayersMute: Not in channel %s"), *ChannelName);
+	}
+
+	const uint32 BatchId = ++LastMuteBatchId;
+	FMuteBatch Batch;
+	Batch.OnCompleted = OnCompleted;
+	for (const FString& PlayerId : PlayerIds)
+	{
+		AddPlayerToMuteBatch(Batch, BatchId, Channel, PlayerId, bMuted);
+	}
+
+	IssueMuteBatch(BatchId, MoveTemp(Batch));
+}
+
+void FAccelByteVivoxVoiceChat::MutePlayerEverywhere(const FString& PlayerId, bool bMuted, const FOnVivoxPlayersMuteCompleted& OnCompleted)
+{
+	MutePlayerEverywhere(TArray<FString>{ PlayerId }, bMuted, OnCompleted);
+}
+
+void FAccelByteVivoxVoiceChat::MutePlayerEverywhere(const TArray<FString>& PlayerIds, bool bMuted, const FOnVivoxPlayersMuteCompleted& OnCompleted)
 {
-#if VIVOX_AVAILABLE
-	const IChannelSession* const* ChannelSessionPtr = ChannelSessions.Find(ChannelName);
-	if (ChannelSessionPtr == nullptr || *ChannelSessionPtr == nullptr)
+	ACCELBYTEVIVOX_TRACE_SCOPE(MutePlayerEverywhere);
+	const uint32 BatchId = ++LastMuteBatchId;
+	FMuteBatch Batch;
+	Batch.OnCompleted = OnCompleted;
+	for (const FString& PlayerId : PlayerIds)
+	{
+		const TArray<FAccelByteVivoxChannelHandle, TInlineAllocator<4>>* PlayerChannelList = PlayerChannels.Find(PlayerId);
+		if (PlayerChannelList == nullptr)
+		{
+			UE_LOG(LogAccelByteVivox, Warning, TEXT("MutePlayerEverywhere: Player %s is not in any channel"), *PlayerId);
+			Batch.Results.Add(PlayerId, false);
+			continue;
+		}
+
+		for (const FAccelByteVivoxChannelHandle Channel : *PlayerChannelList)
+		{
+			AddPlayerToMuteBatch(Batch, BatchId, Channel, PlayerId, bMuted);
+		}
+	}
+
+	IssueMuteBatch(BatchId, MoveTemp(Batch));
+}
+
+void FAccelByteVivoxVoiceChat::AddPlayerToMuteBatch(FMuteBatch& Batch, uint32 BatchId, FAccelByteVivoxChannelHandle Channel,
+	const FString& PlayerId, bool bMuted)
+{
+	const bool* PreviousResult = Batch.Results.Find(PlayerId);
+	const bool bSucceededSoFar = PreviousResult == nullptr || *PreviousResult;
+
+	const FChannelState* ChannelState = Channels.Find(Channel);
+	const int32 Slot = ChannelState != nullptr ? ChannelState->FindSlot(PlayerId) : INDEX_NONE;
+	if (Slot == INDEX_NONE)
+	{
+		Batch.Results.Add(PlayerId, false);
+		return;
+	}
+
+	Batch.Results.Add(PlayerId, bSucceededSoFar);
+
+	// Players already in the requested state cost no round trip
+	if (ChannelState->Muted[Slot] == bMuted)
+	{
+		return;
+	}
+
+	const int32 Error = BeginParticipantMute(Channel, ChannelState->ParticipantHandles[Slot], PlayerId, bMuted, BatchId);
+	if (Error == IAccelByteVivoxBackend::Success)
+	{
+		++Batch.PendingRequests;
+	}
+	else
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("Failed to set mute for player %s, error: %d"), *PlayerId, Error);
+		Batch.Results.Add(PlayerId, false);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::IssueMuteBatch(uint32 BatchId, FMuteBatch&& Batch)
+{
+	// Completions are queued, so the batch is registered before any of them is processed
+	if (Batch.PendingRequests > 0)
+	{
+		MuteBatches.Add(BatchId, MoveTemp(Batch));
+		return;
+	}
+
+	Batch.OnCompleted.ExecuteIfBound(Batch.Results);
+}
+
+void FAccelByteVivoxVoiceChat::CompleteMuteBatchRequest(uint32 BatchId, const FString& PlayerId, bool bSuccess)
+{
+	FMuteBatch* Batch = MuteBatches.Find(BatchId);
+	if (Batch == nullptr)
+	{
+		return;
+	}
+
+	if (!bSuccess)
+	{
+		Batch->Results.Add(PlayerId, false);
+	}
+
+	if (--Batch->PendingRequests > 0)
+	{
+		return;
+	}
+
+	FMuteBatch CompletedBatch;
+	MuteBatches.RemoveAndCopyValue(BatchId, CompletedBatch);
+	CompletedBatch.OnCompleted.ExecuteIfBound(CompletedBatch.Results);
+}
+
+void FAccelByteVivoxVoiceChat::SetBlockedPlayers(const TArray<FString>& PlayerIds)
+{
+	ApplyBlockedPlayers(TSet<FString>(PlayerIds));
+	SaveBlockListIfPersistent();
+}
+
+void FAccelByteVivoxVoiceChat::BlockPlayer(const FString& PlayerId)
+{
+	bool bAlreadyBlocked = false;
+	BlockedPlayers.Add(PlayerId, &bAlreadyBlocked);
+	if (bAlreadyBlocked)
+	{
+		return;
+	}
+	SyncBlockedPlayersToBackend();
+
+	if (PlayerChannels.Contains(PlayerId))
+	{
+		MutePlayerEverywhere(PlayerId, true);
+	}
+	SaveBlockListIfPersistent();
+}
+
+void FAccelByteVivoxVoiceChat::UnblockPlayer(const FString& PlayerId)
+{
+	if (BlockedPlayers.Remove(PlayerId) == 0)
+	{
+		return;
+	}
+	SyncBlockedPlayersToBackend();
+
+	if (PlayerChannels.Contains(PlayerId))
+	{
+		MutePlayerEverywhere(PlayerId, false);
+	}
+	SaveBlockListIfPersistent();
+}
+
+bool FAccelByteVivoxVoiceChat::IsPlayerBlocked(const FString& PlayerId) const
+{
+	return BlockedPlayers.Contains(PlayerId);
+}
+
+const TSet<FString>& FAccelByteVivoxVoiceChat::GetBlockedPlayers() const
+{
+	return BlockedPlayers;
+}
+
+void FAccelByteVivoxVoiceChat::ApplyBlockedPlayers(TSet<FString>&& NewBlockedPlayers)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(ApplyBlockedPlayers);
+	// Only players in a channel right now need a mute change; everyone else is handled as they join
+	TArray<FString> PlayersToMute;
+	TArray<FString> PlayersToUnmute;
+	for (const TPair<FString, TArray<FAccelByteVivoxChannelHandle, TInlineAllocator<4>>>& Pair : PlayerChannels)
+	{
+		const bool bWasBlocked = BlockedPlayers.Contains(Pair.Key);
+		const bool bIsBlocked = NewBlockedPlayers.Contains(Pair.Key);
+		if (bIsBlocked && !bWasBlocked)
+		{
+			PlayersToMute.Add(Pair.Key);
+		}
+		else if (bWasBlocked && !bIsBlocked)
+		{
+			PlayersToUnmute.Add(Pair.Key);
+		}
+	}
+
+	BlockedPlayers = MoveTemp(NewBlockedPlayers);
+	SyncBlockedPlayersToBackend();
+
+	if (PlayersToMute.Num() > 0)
+	{
+		MutePlayerEverywhere(PlayersToMute, true);
+	}
+	if (PlayersToUnmute.Num() > 0)
+	{
+		MutePlayerEverywhere(PlayersToUnmute, false);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::SyncBlockedPlayersToBackend()
+{
+	if (Backend.IsValid())
+	{
+		Backend->SetBlockedParticipants(BlockedPlayers);
+	}
+}
+
+FString FAccelByteVivoxVoiceChat::GetBlockListFilePath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AccelByteVivox"), TEXT("BlockList.bin"));
+}
+
+bool FAccelByteVivoxVoiceChat::LoadBlockList()
+{
+	const FString FilePath = GetBlockListFilePath();
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *FilePath, FILEREAD_Silent))
 	{
+		// Nothing saved yet
 		return false;
 	}
 
-	const IParticipant* Participant = (*ChannelSessionPtr)->Participants().FindRef(PlayerId);
-	if (Participant == nullptr)
+	FMemoryReader Reader(Data);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	TArray<FString> PlayerIds;
+	Reader << Magic;
+	Reader << Version;
+	if (Magic != BlockListFileMagic || Version != BlockListFileVersion)
 	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("LoadBlockList: Unrecognized block list file %s"), *FilePath);
 		return false;
 	}
 
-	return Participant->LocalMute();
-#else
-	return false;
-#endif
+	Reader << PlayerIds;
+	if (Reader.IsError())
+	{
+		UE_LOG(LogAccelByteVivox, Warning, TEXT("LoadBlockList: Block list file %s is corrupt"), *FilePath);
+		return false;
+	}
+
+	ApplyBlockedPlayers(TSet<FString>(PlayerIds));
+	UE_LOG(LogAccelByteVivox, Log, TEXT("Loaded %d blocked players"), BlockedPlayers.Num());
+	return true;
 }
 
-#if VIVOX_AVAILABLE
-void FAccelByteVivoxVoiceChat::HandleParticipantAdded(const IParticipant& Participant)
+bool FAccelByteVivoxVoiceChat::SaveBlockList() const
+{
+	uint32 Magic = BlockListFileMagic;
+	uint32 Version = BlockListFileVersion;
+	TArray<FString> PlayerIds = BlockedPlayers.Array();
+
+	// Ids are plain ASCII, which FString serialization stores at one byte per character
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	Writer << Magic;
+	Writer << Version;
+	Writer << PlayerIds;
+
+	const FString FilePath = GetBlockListFilePath();
+	if (!FFileHelper::SaveArrayToFile(Data, *FilePath))
+	{
+		UE_LOG(LogAccelByteVivox, Error, TEXT("SaveBlockList: Failed to write %s"), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+void FAccelByteVivoxVoiceChat::SaveBlockListIfPersistent() const
+{
+	if (UAccelByteVivoxSettings::Get()->bPersistBlockList)
+	{
+		SaveBlockList();
+	}
+}
+
+void FAccelByteVivoxVoiceChat::RemovePlayerChannel(const FString& PlayerId, FAccelByteVivoxChannelHandle Channel)
+{
+	TArray<FAccelByteVivoxChannelHandle, TInlineAllocator<4>>* PlayerChannelList = PlayerChannels.Find(PlayerId);
+	if (PlayerChannelList == nullptr)
+	{
+		return;
+	}
+
+	PlayerChannelList->RemoveSingleSwap(Channel, NoShrinking);
+	if (PlayerChannelList->Num() == 0)
+	{
+		RemoveKeepingKey(PlayerChannels, PlayerId, SpareParticipantStrings);
+	}
+}
+
+bool FAccelByteVivoxVoiceChat::IsPlayerMuted(const FString& ChannelName, const FString& PlayerId) const
+{
+	const FChannelState* ChannelState = Channels.Find(GetChannelHandle(ChannelName));
+	const int32 Slot = ChannelState != nullptr ? ChannelState->FindSlot(PlayerId) : INDEX_NONE;
+	return Slot != INDEX_NONE && ChannelState->Muted[Slot];
+}
+
+FAccelByteVivoxChannelHandle FAccelByteVivoxVoiceChat::GetChannelHandle(const FString& ChannelName) const
+{
+	return ChannelHandlesByName.FindRef(ChannelName);
+}
+
+FAccelByteVivoxParticipantHandle FAccelByteVivoxVoiceChat::GetParticipantHandle(FAccelByteVivoxChannelHandle Channel, const FString& ParticipantId) const
+{
+	const FChannelState* ChannelState = Channels.Find(Channel);
+	return ChannelState != nullptr ? ChannelState->ParticipantHandlesById.FindRef(ParticipantId) : FAccelByteVivoxParticipantHandle();
+}
+
+const FString* FAccelByteVivoxVoiceChat::GetChannelName(FAccelByteVivoxChannelHandle Channel) const
+{
+	const FChannelState* ChannelState = Channels.Find(Channel);
+	return ChannelState != nullptr ? &ChannelState->ChannelName : nullptr;
+}
+
+const FString* FAccelByteVivoxVoiceChat::GetParticipantId(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant) const
+{
+	const FChannelState* ChannelState = Channels.Find(Channel);
+	const int32 Slot = ChannelState != nullptr ? ChannelState->FindSlot(Participant) : INDEX_NONE;
+	return Slot != INDEX_NONE ? &ChannelState->ParticipantIds[Slot] : nullptr;
+}
+
+const FString* FAccelByteVivoxVoiceChat::GetParticipantDisplayName(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant) const
+{
+	const FChannelState* ChannelState = Channels.Find(Channel);
+	const int32 Slot = ChannelState != nullptr ? ChannelState->FindSlot(Participant) : INDEX_NONE;
+	return Slot != INDEX_NONE ? &ChannelState->DisplayNames[Slot] : nullptr;
+}
+
+int32 FAccelByteVivoxVoiceChat::GetParticipantCount(const FString& ChannelName) const
+{
+	return GetParticipantCount(GetChannelHandle(ChannelName));
+}
+
+int32 FAccelByteVivoxVoiceChat::GetParticipantCount(FAccelByteVivoxChannelHandle Channel) const
+{
+	const FChannelState* ChannelState = Channels.Find(Channel);
+	return ChannelState != nullptr ? ChannelState->Num() : 0;
+}
+
+bool FAccelByteVivoxVoiceChat::IsTalking(const FString& ChannelName, const FString& PlayerId) const
+{
+	const FChannelState* ChannelState = Channels.Find(GetChannelHandle(ChannelName));
+	const int32 Slot = ChannelState != nullptr ? ChannelState->FindSlot(PlayerId) : INDEX_NONE;
+	return Slot != INDEX_NONE && ChannelState->Talking[Slot];
+}
+
+bool FAccelByteVivoxVoiceChat::IsTalking(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant) const
+{
+	const FChannelState* ChannelState = Channels.Find(Channel);
+	const int32 Slot = ChannelState != nullptr ? ChannelState->FindSlot(Participant) : INDEX_NONE;
+	return Slot != INDEX_NONE && ChannelState->Talking[Slot];
+}
+
+void FAccelByteVivoxVoiceChat::GetTalkingParticipants(const FString& ChannelName, TArray<FString>& OutParticipantIds) const
+{
+	OutParticipantIds.Reset();
+
+	const FChannelState* ChannelState = Channels.Find(GetChannelHandle(ChannelName));
+	if (ChannelState == nullptr)
+	{
+		return;
+	}
+
+	for (TConstSetBitIterator<> It(ChannelState->Talking); It; ++It)
+	{
+		OutParticipantIds.Add(ChannelState->ParticipantIds[It.GetIndex()]);
+	}
+}
+
+void FAccelByteVivoxVoiceChat::GetTalkingParticipants(FAccelByteVivoxChannelHandle Channel, TArray<FAccelByteVivoxParticipantHandle>& OutParticipants) const
+{
+	OutParticipants.Reset();
+
+	const FChannelState* ChannelState = Channels.Find(Channel);
+	if (ChannelState == nullptr)
+	{
+		return;
+	}
+
+	// Walks the packed talking bits a word at a time, skipping silent participants
+	for (TConstSetBitIterator<> It(ChannelState->Talking); It; ++It)
+	{
+		OutParticipants.Add(ChannelState->ParticipantHandles[It.GetIndex()]);
+	}
+}
+
+int32 FAccelByteVivoxVoiceChat::FChannelState::FindSlot(FAccelByteVivoxParticipantHandle Participant) const
+{
+	const int32* Slot = ParticipantSlots.Find(Participant);
+	return Slot != nullptr ? *Slot : INDEX_NONE;
+}
+
+int32 FAccelByteVivoxVoiceChat::FChannelState::FindSlot(const FString& ParticipantId) const
+{
+	const FAccelByteVivoxParticipantHandle* Participant = ParticipantHandlesById.Find(ParticipantId);
+	return Participant != nullptr ? FindSlot(*Participant) : INDEX_NONE;
+}
+
+int32 FAccelByteVivoxVoiceChat::FChannelState::AddParticipant(FAccelByteVivoxParticipantHandle Participant, const FString& ParticipantId,
+	const FString& DisplayName, TArray<FString>& SpareStrings)
+{
+	// A participant id maps to one slot; a re-add under a new handle replaces the old entry
+	const int32 ExistingSlot = FindSlot(ParticipantId);
+	if (ExistingSlot != INDEX_NONE)
+	{
+		RemoveParticipantAt(ExistingSlot, SpareStrings);
+	}
+
+	const int32 Slot = ParticipantHandles.Add(Participant);
+	ParticipantIds.Add(TakeSpareString(SpareStrings, ParticipantId));
+	DisplayNames.Add(TakeSpareString(SpareStrings, DisplayName));
+	Talking.Add(false);
+	ReportedTalking.Add(false);
+	TalkingChangePending.Add(false);
+	RawTalking.Add(false);
+	TalkingHoldPending.Add(false);
+	RawChangedAt.Add(0.0);
+	Muted.Add(false);
+	AudioEnergies.Add(0.0f);
+	AudioEnergyUpdatedAt.Add(0.0);
+
+	ParticipantSlots.Add(Participant, Slot);
+	ParticipantHandlesById.Add(TakeSpareString(SpareStrings, ParticipantId), Participant);
+	return Slot;
+}
+
+void FAccelByteVivoxVoiceChat::FChannelState::RemoveParticipantAt(int32 Slot, TArray<FString>& SpareStrings, FString* OutParticipantId)
 {
-	const FString ChannelName = Participant.ParentChannelSession().Channel().Name();
-	const FString ParticipantId = Participant.Account().Name();
-	const FString DisplayName = Participant.Account().DisplayName();
+	ParticipantSlots.Remove(ParticipantHandles[Slot]);
+	RemoveKeepingKey(ParticipantHandlesById, ParticipantIds[Slot], SpareStrings);
 
-	if (!ParticipantTalkingState.Contains(ChannelName))
+	if (OutParticipantId != nullptr)
+	{
+		*OutParticipantId = MoveTemp(ParticipantIds[Slot]);
+	}
+	else
+	{
+		ReturnSpareString(SpareStrings, MoveTemp(ParticipantIds[Slot]));
+	}
+	ReturnSpareString(SpareStrings, MoveTemp(DisplayNames[Slot]));
+
+	// Capacity is kept, so the next adds do not reallocate
+	ParticipantHandles.RemoveAtSwap(Slot, 1, NoShrinking);
+	ParticipantIds.RemoveAtSwap(Slot, 1, NoShrinking);
+	DisplayNames.RemoveAtSwap(Slot, 1, NoShrinking);
+	Talking.RemoveAtSwap(Slot, 1, NoShrinking);
+	ReportedTalking.RemoveAtSwap(Slot, 1, NoShrinking);
+	TalkingChangePending.RemoveAtSwap(Slot, 1, NoShrinking);
+	RawTalking.RemoveAtSwap(Slot, 1, NoShrinking);
+	TalkingHoldPending.RemoveAtSwap(Slot, 1, NoShrinking);
+	RawChangedAt.RemoveAtSwap(Slot, 1, NoShrinking);
+	Muted.RemoveAtSwap(Slot, 1, NoShrinking);
+	AudioEnergies.RemoveAtSwap(Slot, 1, NoShrinking);
+	AudioEnergyUpdatedAt.RemoveAtSwap(Slot, 1, NoShrinking);
+
+	if (Slot < ParticipantHandles.Num())
 	{
-		ParticipantTalkingState.Add(ChannelName, TMap<FString, bool>());
+		ParticipantSlots.Add(ParticipantHandles[Slot], Slot);
 	}
-	ParticipantTalkingState[ChannelName].Add(ParticipantId, false);
+}
 
-	UE_LOG(LogAccelByteVivox, Log, TEXT("Participant added: %s in channel %s"), *ParticipantId, *ChannelName);
-	OnParticipantAdded.Broadcast(ChannelName, ParticipantId, DisplayName);
+void FAccelByteVivoxVoiceChat::OnBackendParticipantAdded(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+	bool bMuted)
+{
+	EnqueueRosterEvent(ERosterEventType::ParticipantAdded, Channel, Participant, bMuted);
+}
+
+void FAccelByteVivoxVoiceChat::OnBackendParticipantRemoved(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant)
+{
+	EnqueueRosterEvent(ERosterEventType::ParticipantRemoved, Channel, Participant);
 }
 
-void FAccelByteVivoxVoiceChat::HandleParticipantRemoved(const IParticipant& Participant)
+void FAccelByteVivoxVoiceChat::OnBackendParticipantUpdated(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+	bool bSpeechDetected, float AudioEnergy)
 {
-	const FString ChannelName = Participant.ParentChannelSession().Channel().Name();
-	const FString ParticipantId = Participant.Account().Name();
+	EnqueueRosterEvent(ERosterEventType::ParticipantUpdated, Channel, Participant, bSpeechDetected, AudioEnergy);
+}
+
+void FAccelByteVivoxVoiceChat::HandleParticipantAdded(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+	bool bMutedByBackend)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleParticipantAdded);
+	FChannelState* ChannelState = Channels.Find(Channel);
+	if (ChannelState == nullptr
+		|| !Backend->GetParticipantInfo(Channel, Participant, AddedParticipantId, AddedParticipantDisplayName))
+	{
+		return;
+	}
+
+	const FString& ParticipantId = AddedParticipantId;
+	const FString& DisplayName = AddedParticipantDisplayName;
+
+	const int32 Slot = ChannelState->AddParticipant(Participant, ParticipantId, DisplayName, SpareParticipantStrings);
+	if (TArray<FAccelByteVivoxChannelHandle, TInlineAllocator<4>>* PlayerChannelList = PlayerChannels.Find(ParticipantId))
+	{
+		PlayerChannelList->AddUnique(Channel);
+	}
+	else
+	{
+		PlayerChannels.Add(TakeSpareString(SpareParticipantStrings, ParticipantId)).Add(Channel);
+	}
+
+	if (!ChannelState->bParticipantSeen)
+	{
+		ChannelState->bParticipantSeen = true;
+		RecordLatency(EAccelByteVivoxLatencyStage::FirstParticipant, FPlatformTime::Seconds() - ChannelState->ConnectStartedAt);
+	}
+
+	UE_LOG(LogAccelByteVivox, Verbose, TEXT("Participant added: %s in channel %s"), *ParticipantId, *ChannelState->ChannelName);
+
+	// The backend already muted the player if they were blocked when it saw them join. The block list may have changed
+	// since, and mutes restored after a rejoin are only known here, so the difference is issued now.
+	const bool bRestoreMute = ChannelState->MutesToRestore.Num() > 0 && ChannelState->MutesToRestore.Remove(ParticipantId) > 0;
+	const bool bShouldMute = bRestoreMute || (BlockedPlayers.Num() > 0 && BlockedPlayers.Contains(ParticipantId));
+	bool bMuted = bMutedByBackend;
+	if (bShouldMute != bMutedByBackend)
+	{
+		const int32 Error = BeginParticipantMute(Channel, Participant, ParticipantId, bShouldMute, 0);
+		if (Error == IAccelByteVivoxBackend::Success)
+		{
+			bMuted = bShouldMute;
+		}
+		else
+		{
+			UE_LOG(LogAccelByteVivox, Error, TEXT("Failed to set mute for player %s, error: %d"), *ParticipantId, Error);
+		}
+	}
+	// Set as soon as the mute is issued, so IsPlayerMuted is right from OnParticipantAdded on
+	ChannelState->Muted[Slot] = bMuted;
 
-	if (ParticipantTalkingState.Contains(ChannelName))
+	OnParticipantAdded.Broadcast(ChannelState->ChannelName, ParticipantId, DisplayName);
+}
+
+void FAccelByteVivoxVoiceChat::HandleParticipantRemoved(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant)
+{
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleParticipantRemoved);
+	// The wrapper has its own copy of the id from the add, so the backend can drop its one now
+	Backend->ReleaseParticipant(Channel, Participant);
+	FChannelState* ChannelState = Channels.Find(Channel);
+	const int32 Slot = ChannelState != nullptr ? ChannelState->FindSlot(Participant) : INDEX_NONE;
+	if (Slot == INDEX_NONE)
 	{
-		ParticipantTalkingState[ChannelName].Remove(ParticipantId);
+		return;
 	}
 
-	UE_LOG(LogAccelByteVivox, Log, TEXT("Participant removed: %s from channel %s"), *ParticipantId, *ChannelName);
-	OnParticipantRemoved.Broadcast(ChannelName, ParticipantId);
+	FString ParticipantId;
+	ChannelState->RemoveParticipantAt(Slot, SpareParticipantStrings, &ParticipantId);
+	RemovePlayerChannel(ParticipantId, Channel);
+
+	RemovedParticipantChannelName.Reset();
+	RemovedParticipantChannelName.Append(ChannelState->ChannelName);
+
+	UE_LOG(LogAccelByteVivox, Verbose, TEXT("Participant removed: %s from channel %s"), *ParticipantId, *RemovedParticipantChannelName);
+	OnParticipantRemoved.Broadcast(RemovedParticipantChannelName, ParticipantId);
+	ReturnSpareString(SpareParticipantStrings, MoveTemp(ParticipantId));
 }
 
-void FAccelByteVivoxVoiceChat::HandleParticipantUpdated(const IParticipant& Participant)
+void FAccelByteVivoxVoiceChat::HandleParticipantUpdated(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+	bool bSpeechDetected, float AudioEnergy)
 {
-	const FString ChannelName = Participant.ParentChannelSession().Channel().Name();
-	const FString ParticipantId = Participant.Account().Name();
-	const bool bIsTalking = Participant.SpeechDetected();
+	ACCELBYTEVIVOX_TRACE_SCOPE(HandleParticipantUpdated);
+	FChannelState* ChannelState = Channels.Find(Channel);
+	const int32 Slot = ChannelState != nullptr ? ChannelState->FindSlot(Participant) : INDEX_NONE;
+	if (Slot == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (ChannelState->bSampleAudioEnergy)
+	{
+		ChannelState->AudioEnergies[Slot] = AudioEnergy;
+		ChannelState->AudioEnergyUpdatedAt[Slot] = FPlatformTime::Seconds();
+	}
 
-	TMap<FString, bool>* ChannelParticipants = ParticipantTalkingState.Find(ChannelName);
-	if (ChannelParticipants == nullptr)
+	if (ChannelState->RawTalking[Slot] == bSpeechDetected)
 	{
 		return;
 	}
 
-	bool* PreviousTalkingState = ChannelParticipants->Find(ParticipantId);
-	if (PreviousTalkingState == nullptr)
+	ChannelState->RawTalking[Slot] = bSpeechDetected;
+	++ChannelState->TalkingStats.RawTransitions;
+	++TalkingStats.RawTransitions;
+
+	if (ChannelState->Talking[Slot] == bSpeechDetected)
 	{
+		// Flipped back before the previous change outlasted its hold time
+		ChannelState->TalkingHoldPending[Slot] = false;
+		ChannelState->TalkingStats.SuppressedTransitions += 2;
+		TalkingStats.SuppressedTransitions += 2;
 		return;
 	}
 
-	if (*PreviousTalkingState != bIsTalking)
+	const float HoldSeconds = bSpeechDetected ? ChannelState->TalkingAttackSeconds : ChannelState->TalkingReleaseSeconds;
+	if (HoldSeconds > 0.0f)
 	{
-		*PreviousTalkingState = bIsTalking;
-		OnParticipantTalkingChanged.Broadcast(ChannelName, ParticipantId, bIsTalking);
+		// Applied from Tick once the hold time has elapsed
+		ChannelState->TalkingHoldPending[Slot] = true;
+		ChannelState->RawChangedAt[Slot] = FPlatformTime::Seconds();
+		return;
 	}
+
+	ApplyTalkingChange(Channel, *ChannelState, Slot, bSpeechDetected);
+}
+
+void FAccelByteVivoxVoiceChat::ApplyTalkingChange(FAccelByteVivoxChannelHandle Channel, FChannelState& ChannelState, int32 Slot, bool bTalking)
+{
+	ChannelState.Talking[Slot] = bTalking;
+	if (bTalking && !ChannelState.bStandby)
+	{
+		ChannelState.LastActiveAt = FPlatformTime::Seconds();
+	}
+	++ChannelState.TalkingStats.AppliedTransitions;
+	++TalkingStats.AppliedTransitions;
+
+	const FAccelByteVivoxParticipantHandle Participant = ChannelState.ParticipantHandles[Slot];
+	if (bCoalesceTalkingEvents)
+	{
+		if (!ChannelState.TalkingChangePending[Slot])
+		{
+			ChannelState.TalkingChangePending[Slot] = true;
+			PendingTalkingChanges.Add({ Channel, Participant });
+		}
+		return;
+	}
+
+	ChannelState.ReportedTalking[Slot] = bTalking;
+	OnParticipantTalkingChanged.Broadcast(ChannelState.ChannelName, ChannelState.ParticipantIds[Slot], bTalking);
+	OnParticipantTalkingChangedByHandle.Broadcast(Channel, Participant, bTalking);
 }
-#endif
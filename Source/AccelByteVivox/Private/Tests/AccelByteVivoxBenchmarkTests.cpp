@@ -0,0 +1,65 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteVivoxBenchmark.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "AccelByteVivoxTestFlags.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteVivoxBenchmarkParticipantPathsTest, "AccelByteVivox.Benchmark.ParticipantPaths",
+	ACCELBYTEVIVOX_TEST_FLAGS)
+
+bool FAccelByteVivoxBenchmarkParticipantPathsTest::RunTest(const FString& Parameters)
+{
+	FAccelByteVivoxBenchmarkConfig Config;
+	Config.ParticipantCounts = { 10, 100 };
+	Config.SpeechUpdatesPerParticipant = 4;
+
+	const TArray<FAccelByteVivoxBenchmarkResult> Results = FAccelByteVivoxBenchmark::Run(Config);
+
+	// Run stops early, with an error logged, when the fake session cannot be set up
+	if (!TestEqual(TEXT("Result count"), Results.Num(), Config.ParticipantCounts.Num() * FAccelByteVivoxBenchmark::CaseCount))
+	{
+		return false;
+	}
+
+	for (const FAccelByteVivoxBenchmarkResult& Result : Results)
+	{
+		const FString What = FString::Printf(TEXT("%s with %d participants"), *Result.Case, Result.Participants);
+		TestTrue(What + TEXT(" processed events"), Result.Events > 0);
+		TestTrue(What + TEXT(" was timed"), Result.NanosecondsPerEvent > 0.0);
+		TestEqual(What + TEXT(" dropped events"), Result.DroppedEvents, static_cast<int64>(0));
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteVivoxBenchmarkParticipantPathAllocationsTest, "AccelByteVivox.Benchmark.ParticipantPathAllocations",
+	ACCELBYTEVIVOX_TEST_FLAGS)
+
+bool FAccelByteVivoxBenchmarkParticipantPathAllocationsTest::RunTest(const FString& Parameters)
+{
+	if (!FAccelByteVivoxBenchmark::CountsAllocations())
+	{
+		AddInfo(TEXT("Allocations are not counted in this build configuration"));
+		return true;
+	}
+
+	FAccelByteVivoxBenchmarkConfig Config;
+	Config.ParticipantCounts = { 10, 100, 500 };
+	Config.SpeechUpdatesPerParticipant = 4;
+
+	const TArray<FAccelByteVivoxBenchmarkResult> Results = FAccelByteVivoxBenchmark::Run(Config);
+	if (!TestEqual(TEXT("Result count"), Results.Num(), Config.ParticipantCounts.Num() * FAccelByteVivoxBenchmark::CaseCount))
+	{
+		return false;
+	}
+
+	// Logs the offending cases. A dropped event never reached the producer side of the queue, so it was not counted.
+	TestTrue(TEXT("Every participant event was queued"), FAccelByteVivoxBenchmark::CheckNoDroppedEvents(Results));
+	TestTrue(TEXT("Participant added, updated and removed made no allocations"),
+		FAccelByteVivoxBenchmark::CheckParticipantPathAllocations(Results));
+	return true;
+}
+#endif
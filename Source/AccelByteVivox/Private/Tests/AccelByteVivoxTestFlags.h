@@ -0,0 +1,12 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "Misc/AutomationTest.h"
+
+// The tests run on the fake backend and need no world, so they run in the editor, in -game and in commandlets
+#define ACCELBYTEVIVOX_TEST_FLAGS \
+	(EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::CommandletContext \
+		| EAutomationTestFlags::ProductFilter)
@@ -0,0 +1,125 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/AccelByteApiClient.h"
+#include "AccelByteVivoxTypes.h"
+
+enum class EAccelByteVivoxTokenType : uint8
+{
+	Login,
+	Join
+};
+
+struct FAccelByteVivoxTokenRequest
+{
+	EAccelByteVivoxTokenType Type = EAccelByteVivoxTokenType::Login;
+	FString Username;
+	FString ChannelName;
+	// Join tokens only
+	bool bPositional = false;
+};
+
+DECLARE_DELEGATE_TwoParams(FOnAccelByteVivoxTokenReceived, const FString& /*AccessToken*/, const FString& /*Uri*/);
+DECLARE_DELEGATE_TwoParams(FOnAccelByteVivoxTokenFailed, int32 /*ErrorCode*/, const FString& /*ErrorMessage*/);
+DECLARE_DELEGATE_OneParam(FOnAccelByteVivoxBackendCompleted, int32 /*Error*/);
+
+/**
+ * Receives the events a backend raises on its own, outside of any request completion.
+ * Implemented by FAccelByteVivoxVoiceChat.
+ *
+ * Channels are identified by the handle passed to BeginConnect. The backend assigns a participant handle when it first
+ * reports a participant and uses it for every later event, so no participant event carries strings; the id and display
+ * name are read back with GetParticipantInfo.
+ *
+ * Threading: a backend may call the listener from any thread, including SDK callback threads and more than one thread
+ * at a time, and never while holding a lock its own methods take. The listener must not call back into the backend
+ * from these methods; FAccelByteVivoxVoiceChat only queues the event for the game thread. Backends must keep their
+ * own state consistent between these callbacks and the game-thread calls below.
+ */
+class IAccelByteVivoxBackendListener
+{
+public:
+	virtual ~IAccelByteVivoxBackendListener() = default;
+
+	virtual void OnBackendLoggedOut() = 0;
+	virtual void OnBackendChannelDisconnected(FAccelByteVivoxChannelHandle Channel) = 0;
+	// bMuted is set when the backend muted the participant on arrival because they are blocked
+	virtual void OnBackendParticipantAdded(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		bool bMuted) = 0;
+	virtual void OnBackendParticipantRemoved(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant) = 0;
+	virtual void OnBackendParticipantUpdated(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		bool bSpeechDetected, float AudioEnergy) = 0;
+};
+
+/**
+ * Everything FAccelByteVivoxVoiceChat needs from the voice SDK and the AccelByte token service.
+ *
+ * Begin* calls return Success when the request was issued and report the final result through their completion
+ * delegate. Error codes are backend specific, apart from the negative values declared here.
+ */
+class ACCELBYTEVIVOX_API IAccelByteVivoxBackend
+{
+public:
+	static constexpr int32 Success = 0;
+	static constexpr int32 ErrorNotFound = -1;
+	static constexpr int32 ErrorInvalidState = -2;
+
+	virtual ~IAccelByteVivoxBackend() = default;
+
+	virtual const TCHAR* GetName() const = 0;
+
+	// Lifecycle
+	virtual int32 Initialize(IAccelByteVivoxBackendListener* InListener) = 0;
+	virtual void Uninitialize() = 0;
+	virtual void Tick(float DeltaSeconds) {}
+
+	// Tokens
+	virtual void RequestToken(const AccelByte::FApiClientPtr& ApiClient, const FAccelByteVivoxTokenRequest& Request,
+		const FOnAccelByteVivoxTokenReceived& OnReceived, const FOnAccelByteVivoxTokenFailed& OnFailed) = 0;
+
+	// Login session
+	// Optional; sets up whatever BeginLogin needs for Username so that work overlaps with the login token request
+	virtual void PrepareLogin(const FString& Username) {}
+	virtual int32 BeginLogin(const FString& Username, const FString& Server, const FString& AccessToken,
+		const FOnAccelByteVivoxBackendCompleted& OnCompleted) = 0;
+	virtual void Logout() = 0;
+
+	// Channel sessions; PositionalProperties is null for a non-positional channel
+	virtual int32 BeginConnect(FAccelByteVivoxChannelHandle Channel, const FString& ChannelName, const FString& AccessToken,
+		const FAccelByteVivoxPositionalProperties* PositionalProperties, const FOnAccelByteVivoxBackendCompleted& OnCompleted) = 0;
+	virtual void Disconnect(FAccelByteVivoxChannelHandle Channel) = 0;
+	// Drops the channel session and its event bindings without waiting for a disconnect
+	virtual void ReleaseChannel(FAccelByteVivoxChannelHandle Channel) = 0;
+
+	// Participants — the id and display name of every participant reported added stay readable, from the game thread,
+	// until ReleaseParticipant is called after its removed event or the channel is released. Outputs are reset and
+	// appended to, so buffers the caller reuses do not reallocate. False if the participant is unknown.
+	virtual bool GetParticipantInfo(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		FString& OutParticipantId, FString& OutDisplayName) const = 0;
+	virtual void ReleaseParticipant(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant) = 0;
+
+	// Transmission
+	virtual void SetTransmissionChannel(FAccelByteVivoxChannelHandle Channel) = 0;
+	virtual void SetTransmissionToAll() = 0;
+	virtual void SetTransmissionToNone() = 0;
+
+	// Positional channels
+	virtual int32 Set3DPosition(FAccelByteVivoxChannelHandle Channel, const FVector& SpeakerPosition, const FVector& ListenerPosition,
+		const FVector& ListenerForward, const FVector& ListenerUp) = 0;
+
+	// Mute
+	virtual void SetInputMuted(bool bMuted) = 0;
+	// Silences everyone in the channel without leaving it; participant mutes set meanwhile still apply once unmuted
+	virtual int32 SetChannelOutputMuted(FAccelByteVivoxChannelHandle Channel, bool bMuted) = 0;
+	virtual int32 BeginSetParticipantMute(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		bool bMuted, const FOnAccelByteVivoxBackendCompleted& OnCompleted) = 0;
+	// Participants with these ids are muted locally as soon as the backend sees them join, before the added event is
+	// raised, and count as muted through BeginSetParticipantMute from then on. Replaces the previous set.
+	virtual void SetBlockedParticipants(const TSet<FString>& ParticipantIds) = 0;
+};
+
+using FAccelByteVivoxBackendPtr = TSharedPtr<IAccelByteVivoxBackend, ESPMode::ThreadSafe>;
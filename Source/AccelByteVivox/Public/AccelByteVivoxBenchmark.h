@@ -0,0 +1,70 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+struct FAccelByteVivoxBenchmarkConfig
+{
+	// One run per entry; participants are spread evenly across ChannelCount channels
+	TArray<int32> ParticipantCounts = { 10, 50, 100, 250, 500 };
+	int32 ChannelCount = 4;
+
+	// Speech-detected updates sent for every participant, alternating talking and silent
+	int32 SpeechUpdatesPerParticipant = 50;
+
+	// SetPlayerMute and IsPlayerMuted calls made for every participant
+	int32 MuteCallsPerParticipant = 4;
+
+	int32 RandomSeed = 0;
+};
+
+struct FAccelByteVivoxBenchmarkResult
+{
+	FString Case;
+	int32 Participants = 0;
+	int32 Channels = 0;
+	int64 Events = 0;
+	double NanosecondsPerEvent = 0.0;
+	double AllocationsPerEvent = 0.0;
+	// Largest growth of live heap bytes allocated by the calling thread while the case ran
+	int64 PeakBytes = 0;
+	// Participant events the wrapper's roster queue turned away while the case ran; those were never timed
+	int64 DroppedEvents = 0;
+};
+
+/**
+ * Measures the wrapper's participant hot paths headless, on a private FAccelByteVivoxVoiceChat driven by a
+ * FAccelByteVivoxFakeBackend.
+ *
+ * Each run joins the channels and goes through one untimed round of churn, then times participant adds, speech
+ * updates, SetPlayerMute, IsPlayerMuted and participant removes. Participant events are timed from the backend
+ * callback on, so queuing them counts along with processing them; the fake backend's own bookkeeping does not.
+ *
+ * Compiled in with the automation tests only, which run it as AccelByteVivox.Benchmark.*. From a console or the command
+ * line: AccelByteVivox.Benchmark [ParticipantCounts] [Channels], e.g. -ExecCmds="AccelByteVivox.Benchmark 10,100,500 4".
+ */
+class ACCELBYTEVIVOX_API FAccelByteVivoxBenchmark
+{
+public:
+	// Cases timed for every participant count
+	static constexpr int32 CaseCount = 5;
+
+	static TArray<FAccelByteVivoxBenchmarkResult> Run(const FAccelByteVivoxBenchmarkConfig& Config = FAccelByteVivoxBenchmarkConfig());
+
+	// False in shipping builds, where GMalloc is never replaced and AllocationsPerEvent and PeakBytes stay zero
+	static bool CountsAllocations();
+
+	// Logs an error for every participant add, update or remove case that allocated; false if any did
+	static bool CheckParticipantPathAllocations(const TArray<FAccelByteVivoxBenchmarkResult>& Results);
+
+	// Logs an error for every case whose participant events did not all make it onto the wrapper's queue; false if any
+	static bool CheckNoDroppedEvents(const TArray<FAccelByteVivoxBenchmarkResult>& Results);
+
+	// One row per case and participant count
+	static FString ToCsv(const TArray<FAccelByteVivoxBenchmarkResult>& Results);
+};
+#endif
@@ -0,0 +1,142 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+#include <atomic>
+#include <type_traits>
+
+/**
+ * Bounded lock-free FIFO of small, trivially copyable events, filled from any number of threads and drained by one.
+ *
+ * Every slot carries a sequence number that tells producers and the consumer whose turn it is, so Enqueue and Dequeue
+ * take no lock and never allocate. The ring never grows: Enqueue fails when it is full and the caller decides what
+ * to drop. Initialize sizes it once, before any producer can run.
+ */
+template <typename ElementType>
+class TAccelByteVivoxEventRing
+{
+	static_assert(std::is_trivially_copyable<ElementType>::value, "Ring events are copied in and out as plain values");
+
+public:
+	TAccelByteVivoxEventRing() = default;
+	TAccelByteVivoxEventRing(const TAccelByteVivoxEventRing&) = delete;
+	TAccelByteVivoxEventRing& operator=(const TAccelByteVivoxEventRing&) = delete;
+
+	// Allocates room for at least MinCapacity events, rounded up to a power of two, and drops anything queued.
+	// Not thread safe: call it only while no producer or consumer is running.
+	void Initialize(int32 MinCapacity)
+	{
+		const int32 NewCapacity = static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(MinCapacity, 2))));
+		if (NewCapacity != Capacity)
+		{
+			Cells = MakeUnique<FCell[]>(NewCapacity);
+			Capacity = NewCapacity;
+		}
+
+		for (int32 Index = 0; Index < Capacity; ++Index)
+		{
+			Cells[Index].Sequence.store(static_cast<uint64>(Index), std::memory_order_relaxed);
+		}
+		EnqueuePosition.store(0, std::memory_order_relaxed);
+		DequeuePosition.store(0, std::memory_order_release);
+	}
+
+	// False when the ring is full, or when fewer than Headroom + 1 slots are free, so a caller can keep the last slots
+	// for events that matter more. Safe from any thread.
+	bool Enqueue(const ElementType& Element, int32 Headroom = 0)
+	{
+		if (Capacity == 0 || (Headroom > 0 && Num() >= Capacity - Headroom))
+		{
+			return false;
+		}
+
+		uint64 Position = EnqueuePosition.load(std::memory_order_relaxed);
+		FCell* Cell = nullptr;
+		for (;;)
+		{
+			Cell = &Cells[Position & (Capacity - 1)];
+			const int64 Difference = static_cast<int64>(Cell->Sequence.load(std::memory_order_acquire) - Position);
+			if (Difference == 0)
+			{
+				// The slot is free for this position; claim it unless another producer got there first
+				if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (Difference < 0)
+			{
+				// The consumer has not freed this slot since the last lap
+				return false;
+			}
+			else
+			{
+				Position = EnqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+
+		Cell->Element = Element;
+		Cell->Sequence.store(Position + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Only ever call from the one consumer thread
+	bool Dequeue(ElementType& OutElement)
+	{
+		if (Capacity == 0)
+		{
+			return false;
+		}
+
+		const uint64 Position = DequeuePosition.load(std::memory_order_relaxed);
+		FCell& Cell = Cells[Position & (Capacity - 1)];
+		if (Cell.Sequence.load(std::memory_order_acquire) != Position + 1)
+		{
+			// Empty, or the producer that claimed the slot has not finished writing it
+			return false;
+		}
+
+		OutElement = Cell.Element;
+		Cell.Sequence.store(Position + Capacity, std::memory_order_release);
+		DequeuePosition.store(Position + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	// Consumer only; drops every event queued so far
+	void Empty()
+	{
+		ElementType Element;
+		while (Dequeue(Element))
+		{
+		}
+	}
+
+	// Approximate while producers are running
+	int32 Num() const
+	{
+		const uint64 Enqueued = EnqueuePosition.load(std::memory_order_relaxed);
+		const uint64 Dequeued = DequeuePosition.load(std::memory_order_relaxed);
+		return Enqueued > Dequeued ? static_cast<int32>(FMath::Min<uint64>(Enqueued - Dequeued, Capacity)) : 0;
+	}
+
+	int32 GetCapacity() const { return Capacity; }
+
+private:
+	struct FCell
+	{
+		std::atomic<uint64> Sequence{0};
+		ElementType Element;
+	};
+
+	TUniquePtr<FCell[]> Cells;
+	int32 Capacity = 0;
+
+	// On separate cache lines so producers and the consumer do not contend on one
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> EnqueuePosition{0};
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> DequeuePosition{0};
+};
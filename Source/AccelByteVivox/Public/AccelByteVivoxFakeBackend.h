@@ -0,0 +1,203 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AccelByteVivoxBackend.h"
+#include "Math/RandomStream.h"
+
+// Development and test only; automation tests may pull it into a shipping build, but nothing selects it there
+#if !UE_BUILD_SHIPPING || WITH_DEV_AUTOMATION_TESTS
+#define ACCELBYTEVIVOX_WITH_FAKE_BACKEND 1
+#else
+#define ACCELBYTEVIVOX_WITH_FAKE_BACKEND 0
+#endif
+
+#if ACCELBYTEVIVOX_WITH_FAKE_BACKEND
+enum class EAccelByteVivoxFakeOperation : uint8
+{
+	Token,
+	Login,
+	Connect,
+	Mute
+};
+
+struct FAccelByteVivoxFakeBackendConfig
+{
+	float TokenLatencySeconds = 0.05f;
+	float LoginLatencySeconds = 0.1f;
+	float ConnectLatencySeconds = 0.1f;
+	float DisconnectLatencySeconds = 0.05f;
+	float MuteLatencySeconds = 0.02f;
+
+	// Uniform jitter added to every latency, drawn from a stream seeded with RandomSeed
+	float LatencyJitterSeconds = 0.0f;
+	int32 RandomSeed = 0;
+
+	// Advance the virtual clock from Tick; turn off to drive time with Advance() only
+	bool bAdvanceOnTick = true;
+
+	// Raise a participant added event for the local user when a channel connects, as VivoxCore does
+	bool bAddLocalParticipantOnConnect = true;
+};
+
+struct FAccelByteVivoxFakeBackendStats
+{
+	int32 TokenRequests = 0;
+	int32 LoginRequests = 0;
+	int32 ConnectRequests = 0;
+	int32 DisconnectRequests = 0;
+	int32 MuteRequests = 0;
+	int32 PositionUpdates = 0;
+};
+
+/**
+ * Deterministic in-process backend for headless profiling and soak tests.
+ *
+ * Requests complete after configurable latencies measured on a virtual clock, in the order they are due. Participant,
+ * disconnect and logout events can be injected at any time and are delivered to the listener synchronously.
+ * The fake is not thread safe: drive it from one thread, which is then the only thread that raises its events.
+ */
+class ACCELBYTEVIVOX_API FAccelByteVivoxFakeBackend : public IAccelByteVivoxBackend
+{
+public:
+	explicit FAccelByteVivoxFakeBackend(const FAccelByteVivoxFakeBackendConfig& InConfig = FAccelByteVivoxFakeBackendConfig());
+
+	virtual const TCHAR* GetName() const override { return TEXT("Fake"); }
+
+	virtual int32 Initialize(IAccelByteVivoxBackendListener* InListener) override;
+	virtual void Uninitialize() override;
+	virtual void Tick(float DeltaSeconds) override;
+
+	virtual void RequestToken(const AccelByte::FApiClientPtr& ApiClient, const FAccelByteVivoxTokenRequest& Request,
+		const FOnAccelByteVivoxTokenReceived& OnReceived, const FOnAccelByteVivoxTokenFailed& OnFailed) override;
+
+	virtual int32 BeginLogin(const FString& Username, const FString& Server, const FString& AccessToken,
+		const FOnAccelByteVivoxBackendCompleted& OnCompleted) override;
+	virtual void Logout() override;
+
+	virtual int32 BeginConnect(FAccelByteVivoxChannelHandle Channel, const FString& ChannelName, const FString& AccessToken,
+		const FAccelByteVivoxPositionalProperties* PositionalProperties, const FOnAccelByteVivoxBackendCompleted& OnCompleted) override;
+	virtual void Disconnect(FAccelByteVivoxChannelHandle Channel) override;
+	virtual void ReleaseChannel(FAccelByteVivoxChannelHandle Channel) override;
+
+	virtual bool GetParticipantInfo(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		FString& OutParticipantId, FString& OutDisplayName) const override;
+	virtual void ReleaseParticipant(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant) override;
+
+	virtual void SetTransmissionChannel(FAccelByteVivoxChannelHandle Channel) override;
+	virtual void SetTransmissionToAll() override;
+	virtual void SetTransmissionToNone() override;
+
+	virtual int32 Set3DPosition(FAccelByteVivoxChannelHandle Channel, const FVector& SpeakerPosition, const FVector& ListenerPosition,
+		const FVector& ListenerForward, const FVector& ListenerUp) override;
+
+	virtual void SetInputMuted(bool bMuted) override;
+	virtual int32 SetChannelOutputMuted(FAccelByteVivoxChannelHandle Channel, bool bMuted) override;
+	virtual int32 BeginSetParticipantMute(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		bool bMuted, const FOnAccelByteVivoxBackendCompleted& OnCompleted) override;
+	virtual void SetBlockedParticipants(const TSet<FString>& ParticipantIds) override;
+
+	// Virtual clock
+	void Advance(float Seconds);
+	double GetTime() const { return Now; }
+	int32 GetPendingActionCount() const { return ScheduledActions.Num(); }
+
+	// Sends events to another listener than the one passed to Initialize, e.g. one that records them for later delivery
+	void SetListener(IAccelByteVivoxBackendListener* InListener) { Listener = InListener; }
+
+	// Fails the next request of the given kind with ErrorCode instead of completing it
+	void FailNextOperation(EAccelByteVivoxFakeOperation Operation, int32 ErrorCode);
+
+	// Event injection; participant events are ignored for channels that are not connected
+	bool InjectParticipantAdded(const FString& ChannelName, const FString& ParticipantId, const FString& DisplayName = FString());
+	bool InjectParticipantRemoved(const FString& ChannelName, const FString& ParticipantId);
+	bool InjectParticipantUpdated(const FString& ChannelName, const FString& ParticipantId, bool bSpeechDetected, float AudioEnergy = 0.0f);
+	bool InjectChannelDisconnected(const FString& ChannelName);
+	bool InjectLoggedOut();
+
+	// Inspection
+	bool IsLoggedIn() const { return bLoggedIn; }
+	bool IsChannelConnected(const FString& ChannelName) const;
+	int32 GetParticipantCount(const FString& ChannelName) const;
+	bool IsParticipantMuted(const FString& ChannelName, const FString& ParticipantId) const;
+	bool IsChannelPositional(const FString& ChannelName) const;
+	bool IsChannelOutputMuted(const FString& ChannelName) const;
+	// Last listener position sent for the channel, zero if none was
+	FVector GetListenerPosition(const FString& ChannelName) const;
+	bool IsInputMuted() const { return bInputMuted; }
+	const FString& GetTransmissionChannel() const { return TransmissionChannel; }
+	bool IsTransmittingToAll() const { return bTransmitToAll; }
+	const FAccelByteVivoxFakeBackendStats& GetStats() const { return Stats; }
+	FAccelByteVivoxFakeBackendConfig& GetConfig() { return Config; }
+
+private:
+	struct FFakeParticipant
+	{
+		FAccelByteVivoxParticipantHandle Handle;
+		FString DisplayName;
+		bool bMuted = false;
+	};
+
+	struct FReportedParticipant
+	{
+		FString Id;
+		FString DisplayName;
+	};
+
+	struct FFakeChannel
+	{
+		FAccelByteVivoxChannelHandle Handle;
+		bool bConnected = false;
+		bool bPositional = false;
+		bool bOutputMuted = false;
+		FVector ListenerPosition = FVector::ZeroVector;
+		TMap<FString, FFakeParticipant> Participants;
+		// Every participant reported added and not yet released, including removed ones
+		TMap<FAccelByteVivoxParticipantHandle, FReportedParticipant> ReportedParticipants;
+	};
+
+	struct FScheduledAction
+	{
+		double Time = 0.0;
+		uint64 Sequence = 0;
+		TFunction<void()> Action;
+	};
+
+	FAccelByteVivoxFakeBackendConfig Config;
+	FAccelByteVivoxFakeBackendStats Stats;
+	FRandomStream RandomStream;
+	IAccelByteVivoxBackendListener* Listener = nullptr;
+	bool bInitialized = false;
+
+	double Now = 0.0;
+	uint64 NextSequence = 0;
+	TArray<FScheduledAction> ScheduledActions;
+	TMap<EAccelByteVivoxFakeOperation, int32> PendingFailures;
+
+	bool bLoggedIn = false;
+	bool bInputMuted = false;
+	bool bTransmitToAll = false;
+	FString LoggedInUsername;
+	FString TransmissionChannel;
+	TMap<FString, FFakeChannel> Channels;
+	TMap<FAccelByteVivoxChannelHandle, FString> ChannelNames;
+	TSet<FString> BlockedParticipantIds;
+	uint32 LastParticipantHandle = 0;
+	uint64 NextTokenId = 0;
+
+	// Bumped on logout so login completions scheduled before it are dropped
+	uint32 LoginEpoch = 0;
+
+	static bool IsDueBefore(const FScheduledAction& A, const FScheduledAction& B);
+	void Schedule(float LatencySeconds, TFunction<void()>&& Action);
+	int32 ConsumeFailure(EAccelByteVivoxFakeOperation Operation);
+
+	FFakeChannel* FindChannel(FAccelByteVivoxChannelHandle Channel, FString* OutChannelName = nullptr);
+	const FFakeChannel* FindChannel(FAccelByteVivoxChannelHandle Channel) const;
+	static const FFakeParticipant* FindParticipant(const FFakeChannel& Channel, FAccelByteVivoxParticipantHandle Participant, FString* OutParticipantId = nullptr);
+	bool RemoveChannel(const FString& ChannelName);
+};
+#endif
@@ -0,0 +1,73 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EAccelByteVivoxLatencyStage : uint8
+{
+	// Login token request to its response
+	LoginToken,
+	// BeginLogin to the login session reporting success
+	LoginSession,
+	// Login() to OnLoginCompleted
+	Login,
+	// Join token request to its response, whether for a join or a prefetch
+	JoinToken,
+	// BeginConnect to the channel reporting success
+	ChannelConnect,
+	// BeginConnect to the first participant event of the channel
+	FirstParticipant,
+	// JoinChannel to OnChannelJoined
+	Join,
+
+	Count
+};
+
+ACCELBYTEVIVOX_API const TCHAR* LexToString(EAccelByteVivoxLatencyStage Stage);
+
+struct FAccelByteVivoxLatencySummary
+{
+	uint64 Count = 0;
+	double MinSeconds = 0.0;
+	double MeanSeconds = 0.0;
+	double P50Seconds = 0.0;
+	double P95Seconds = 0.0;
+	double P99Seconds = 0.0;
+	double MaxSeconds = 0.0;
+};
+
+/**
+ * Latencies counted in log-spaced buckets, eight per doubling from 1 ms to a little over a minute, so adding a sample
+ * never allocates. Percentiles are reported at bucket resolution, within about 9% of the true value.
+ */
+class ACCELBYTEVIVOX_API FAccelByteVivoxLatencyHistogram
+{
+public:
+	FAccelByteVivoxLatencyHistogram();
+
+	void Add(double Seconds);
+	void Reset();
+
+	uint64 GetCount() const { return Count; }
+	// Percentile from 0 to 100; 0.0 while there are no samples
+	double GetPercentile(double Percentile) const;
+	FAccelByteVivoxLatencySummary GetSummary() const;
+
+private:
+	static constexpr int32 BucketsPerDoubling = 8;
+	static constexpr int32 NumDoublings = 16;
+	// Bucket 0 holds everything under 1 ms and the last bucket everything past the top of the range
+	static constexpr int32 NumBuckets = NumDoublings * BucketsPerDoubling + 2;
+
+	static int32 GetBucketIndex(double Seconds);
+	static double GetBucketUpperBound(int32 Index);
+
+	uint32 Buckets[NumBuckets];
+	uint64 Count = 0;
+	double SumSeconds = 0.0;
+	double MinSeconds = 0.0;
+	double MaxSeconds = 0.0;
+};
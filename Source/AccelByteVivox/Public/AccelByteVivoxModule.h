@@ -12,4 +12,9 @@ class FAccelByteVivoxModule : public IModuleInterface
 public:
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+private:
+	// Starts the shutdown drain when bDrainOnExit is set
+	void HandleEnginePreExit();
+	FDelegateHandle EnginePreExitHandle;
 };
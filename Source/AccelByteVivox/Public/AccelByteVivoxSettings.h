@@ -18,9 +18,113 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox")
 	FString VivoxIssuer;
 
-	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox")
-	FString VivoxDomain;
-
-	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox")
-	FString VivoxServer;
-};
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox")
+	FString VivoxDomain;
+
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox")
+	FString VivoxServer;
+
+	/** How long a prefetched join token stays usable. Keep it below the lifetime the Vivox auth service issues. */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox", meta = (ClampMin = "1.0", Units = "Seconds"))
+	float JoinTokenCacheLifetimeSeconds = 60.0f;
+
+	/** How long a token fetched by PrefetchLoginToken stays usable by Login(). */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox", meta = (ClampMin = "1.0", Units = "Seconds"))
+	float LoginTokenCacheLifetimeSeconds = 60.0f;
+
+	/** Development only: run against the in-process fake backend instead of VivoxCore, e.g. for headless profiling and soak tests. Ignored in shipping builds, which do not include the fake. */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox")
+	bool bUseFakeBackend = false;
+
+	/** Collect talking changes and deliver them once per tick through OnParticipantTalkingBatch instead of per event. */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox")
+	bool bCoalesceTalkingEvents = false;
+
+	/** How long a participant must keep speaking before they are reported as talking. 0 reports immediately. */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox", meta = (ClampMin = "0.0", Units = "Seconds"))
+	float TalkingAttackSeconds = 0.0f;
+
+	/** How long a participant must stay silent before they are reported as no longer talking. 0 reports immediately. */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox", meta = (ClampMin = "0.0", Units = "Seconds"))
+	float TalkingReleaseSeconds = 0.0f;
+
+	/** How often audio energy snapshots are refreshed for channels with an energy subscription. */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox", meta = (ClampMin = "1.0", ClampMax = "120.0", Units = "Hertz"))
+	float AudioEnergySampleRateHz = 20.0f;
+
+	/**
+	 * Time per tick for processing participant events; the rest carry over to the next tick. Login, channel and mute
+	 * events are always processed in full and ahead of participant events. 0 processes everything every tick.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox", meta = (ClampMin = "0.0", Units = "Milliseconds"))
+	float EventProcessingBudgetMs = 0.0f;
+
+	/**
+	 * Participant events the queue holds, allocated once at initialization. The queue never grows: when it is full,
+	 * speech updates are dropped first, then adds and removes, and both are counted in the event queue stats.
+	 * Raise this if either count moves during large joins.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox", meta = (ClampMin = "64"))
+	int32 RosterEventQueueCapacity = 1024;
+
+	/** Most position updates sent per second to each positional channel, however often Set3DPosition is called. */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox|Positional", meta = (ClampMin = "1.0", ClampMax = "60.0", Units = "Hertz"))
+	float PositionUpdateRateHz = 10.0f;
+
+	/** Speaker or listener movement shorter than this since the last update sent is not sent. */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox|Positional", meta = (ClampMin = "0.0", Units = "Centimeters"))
+	float PositionUpdateDistanceThreshold = 10.0f;
+
+	/** Listener rotation smaller than this since the last update sent is not sent. */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox|Positional", meta = (ClampMin = "0.0", ClampMax = "180.0", Units = "Degrees"))
+	float PositionUpdateAngleThresholdDegrees = 2.0f;
+
+	/** How long SwitchChannel keeps the old channel after the new one is up, so speech already in flight is not cut off. */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox", meta = (ClampMin = "0.0", Units = "Seconds"))
+	float ChannelSwitchOverlapSeconds = 0.5f;
+
+	/**
+	 * Most channels held at once, counting joins in progress. A join past it evicts the lowest priority, least recently
+	 * active channel of no higher priority than its own, or fails if there is none. 0 is unlimited.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox|Channel Budget", meta = (ClampMin = "0"))
+	int32 MaxConcurrentChannels = 0;
+
+	/** Load the block list from Saved/AccelByteVivox/BlockList.bin on Initialize() and save it whenever it changes. */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox")
+	bool bPersistBlockList = false;
+
+	/**
+	 * Log back in and rejoin channels when the login session or a channel drops without Logout() or LeaveChannel().
+	 * The transmission target, local mute and player mutes are restored along with them.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox|Reconnect")
+	bool bAutoReconnect = false;
+
+	/** Delay before the first reconnect attempt; doubles with every failed attempt up to ReconnectMaxDelaySeconds. */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox|Reconnect", meta = (ClampMin = "0.0", Units = "Seconds"))
+	float ReconnectInitialDelaySeconds = 1.0f;
+
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox|Reconnect", meta = (ClampMin = "0.0", Units = "Seconds"))
+	float ReconnectMaxDelaySeconds = 30.0f;
+
+	/** Fraction of each delay that is randomized, so clients dropped by the same outage do not retry in lockstep. */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox|Reconnect", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float ReconnectJitter = 0.5f;
+
+	/** Attempts per login session or channel before giving up. 0 keeps trying until Logout(). */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox|Reconnect", meta = (ClampMin = "0"))
+	int32 ReconnectMaxAttempts = 0;
+
+	/** Longest BeginShutdown waits for channel disconnects to be confirmed before tearing everything down anyway. */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox|Shutdown", meta = (ClampMin = "0.0", Units = "Seconds"))
+	float ShutdownDrainTimeoutSeconds = 1.0f;
+
+	/**
+	 * Begin the shutdown as the engine starts to exit, so the disconnects run alongside the rest of engine teardown, and
+	 * wait out what is left of ShutdownDrainTimeoutSeconds when the module shuts down. Otherwise everything is torn down
+	 * at once when the module shuts down.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "AccelByte Vivox|Shutdown")
+	bool bDrainOnExit = false;
+};
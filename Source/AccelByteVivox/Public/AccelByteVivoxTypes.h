@@ -0,0 +1,201 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Identifies one joined channel. Assigned once when the channel session is created and never reused.
+ */
+struct FAccelByteVivoxChannelHandle
+{
+	FAccelByteVivoxChannelHandle() = default;
+	explicit FAccelByteVivoxChannelHandle(uint32 InValue) : Value(InValue) {}
+
+	bool IsValid() const { return Value != 0; }
+	uint32 GetValue() const { return Value; }
+
+	bool operator==(const FAccelByteVivoxChannelHandle& Other) const { return Value == Other.Value; }
+	bool operator!=(const FAccelByteVivoxChannelHandle& Other) const { return Value != Other.Value; }
+	friend uint32 GetTypeHash(const FAccelByteVivoxChannelHandle& Handle) { return Handle.Value; }
+
+private:
+	uint32 Value = 0;
+};
+
+/**
+ * Identifies one participant in one channel. Assigned by the backend when the participant is added and never reused,
+ * so the same player present in two channels has two handles.
+ */
+struct FAccelByteVivoxParticipantHandle
+{
+	FAccelByteVivoxParticipantHandle() = default;
+	explicit FAccelByteVivoxParticipantHandle(uint32 InValue) : Value(InValue) {}
+
+	bool IsValid() const { return Value != 0; }
+	uint32 GetValue() const { return Value; }
+
+	bool operator==(const FAccelByteVivoxParticipantHandle& Other) const { return Value == Other.Value; }
+	bool operator!=(const FAccelByteVivoxParticipantHandle& Other) const { return Value != Other.Value; }
+	friend uint32 GetTypeHash(const FAccelByteVivoxParticipantHandle& Handle) { return Handle.Value; }
+
+private:
+	uint32 Value = 0;
+};
+
+/**
+ * Identifies one Login or JoinChannel call, for cancelling it while it is still in flight. Never reused.
+ */
+struct FAccelByteVivoxOperationHandle
+{
+	FAccelByteVivoxOperationHandle() = default;
+	explicit FAccelByteVivoxOperationHandle(uint32 InValue) : Value(InValue) {}
+
+	bool IsValid() const { return Value != 0; }
+	uint32 GetValue() const { return Value; }
+
+	bool operator==(const FAccelByteVivoxOperationHandle& Other) const { return Value == Other.Value; }
+	bool operator!=(const FAccelByteVivoxOperationHandle& Other) const { return Value != Other.Value; }
+	friend uint32 GetTypeHash(const FAccelByteVivoxOperationHandle& Handle) { return Handle.Value; }
+
+private:
+	uint32 Value = 0;
+};
+
+struct FAccelByteVivoxTalkingChange
+{
+	FAccelByteVivoxChannelHandle Channel;
+	FAccelByteVivoxParticipantHandle Participant;
+};
+
+/**
+ * Talking transitions collected over one tick. A participant that toggles several times within the tick appears at most
+ * once, with its final state, and not at all if it ends the tick in the state it started in.
+ */
+struct FAccelByteVivoxTalkingChangeSet
+{
+	TArray<FAccelByteVivoxTalkingChange> Started;
+	TArray<FAccelByteVivoxTalkingChange> Stopped;
+
+	bool IsEmpty() const { return Started.Num() == 0 && Stopped.Num() == 0; }
+};
+
+struct FAccelByteVivoxTalkingStats
+{
+	// Speech detected changes reported by the SDK
+	uint64 RawTransitions = 0;
+	// Changes that outlasted the attack or release time and were applied
+	uint64 AppliedTransitions = 0;
+	// Changes reverted before their hold time elapsed; each such flicker counts both of its transitions
+	uint64 SuppressedTransitions = 0;
+};
+
+/**
+ * Audio energy of every participant in one channel, sampled at a fixed rate. Entry i of each array describes the
+ * same participant. The buffers are rewritten in place on the game thread, so read them there and do not hold on to
+ * the snapshot across ticks.
+ */
+struct FAccelByteVivoxAudioEnergySnapshot
+{
+	// Incremented on every sample; 0 until the first one
+	uint64 Sequence = 0;
+	double SampledAt = 0.0;
+
+	TArray<FAccelByteVivoxParticipantHandle> Participants;
+	// 0.0 to 1.0, as reported by the SDK
+	TArray<float> Energies;
+	// When the SDK last reported each energy, 0.0 if it has not yet
+	TArray<double> Timestamps;
+
+	int32 Num() const { return Participants.Num(); }
+};
+
+struct FAccelByteVivoxEventQueueStats
+{
+	// Backend events waiting for the next tick, and how many of those are participant events
+	int32 Pending = 0;
+	int32 PendingRoster = 0;
+	// Most events found waiting at the start of a tick
+	int32 PeakPending = 0;
+	uint64 Processed = 0;
+	// Ticks that ran out of EventProcessingBudgetMs and left participant events for the next tick
+	uint64 BudgetExhaustedTicks = 0;
+	// Size of the participant event ring, and the speech updates and the adds or removes dropped because it was full
+	int32 RosterCapacity = 0;
+	uint64 RosterUpdatesDropped = 0;
+	uint64 RosterMembershipDropped = 0;
+};
+
+struct FAccelByteVivoxLoginTimings
+{
+	// The token came from PrefetchLoginToken rather than a request made by Login()
+	bool bTokenPrefetched = false;
+	// Round trip of the token request, and how much of it Login() actually waited on
+	double TokenRequestSeconds = 0.0;
+	double TokenWaitSeconds = 0.0;
+	// From BeginLogin to the login session reporting its result
+	double SessionLoginSeconds = 0.0;
+	double TotalSeconds = 0.0;
+};
+
+struct FAccelByteVivoxReconnectStats
+{
+	// Login sessions and channels brought back after an unexpected drop, and those given up on
+	int32 Recoveries = 0;
+	int32 Failures = 0;
+	int32 Attempts = 0;
+	// Time from the drop until the login session, with all its channels, or a single channel was back
+	double LastRecoverySeconds = 0.0;
+	double MaxRecoverySeconds = 0.0;
+	double TotalRecoverySeconds = 0.0;
+};
+
+struct FAccelByteVivoxCancellationStats
+{
+	// Logins and joins abandoned while in flight; a shared join counts once, when its last request goes
+	uint64 Cancelled = 0;
+	// Of those, abandoned before their token arrived, so the Vivox login or channel connect never ran
+	uint64 SkippedLogins = 0;
+	uint64 SkippedConnects = 0;
+};
+
+enum class EAccelByteVivoxAudioFadeModel : uint8
+{
+	InverseByDistance,
+	LinearByDistance,
+	ExponentialByDistance
+};
+
+/**
+ * How a positional channel attenuates speakers with distance. Distances are in the same units as the positions passed
+ * to Set3DPosition; the defaults are the VivoxCore defaults.
+ */
+struct FAccelByteVivoxPositionalProperties
+{
+	// Speakers further away than this are not heard at all
+	int32 AudibleDistance = 2700;
+	// Speakers closer than this are heard at full volume
+	int32 ConversationalDistance = 90;
+	float AudioFadeIntensity = 1.0f;
+	EAccelByteVivoxAudioFadeModel AudioFadeModel = EAccelByteVivoxAudioFadeModel::InverseByDistance;
+};
+
+struct FAccelByteVivoxPositionUpdateStats
+{
+	// Set3DPosition calls, and the updates actually sent to the backend across all positional channels
+	uint64 Requested = 0;
+	uint64 Sent = 0;
+};
+
+/**
+ * Decides which channel goes first when a join would exceed MaxConcurrentChannels. A join only evicts channels of its
+ * own priority or lower.
+ */
+enum class EAccelByteVivoxChannelPriority : uint8
+{
+	Low,
+	Normal,
+	High
+};
@@ -6,25 +6,49 @@
 
 #include "CoreMinimal.h"
 #include "Core/AccelByteApiClient.h"
+#include "Containers/Ticker.h"
+#include "Containers/Queue.h"
+#include "AccelByteVivoxBackend.h"
+#include "AccelByteVivoxEventRing.h"
+#include "AccelByteVivoxLatency.h"
+#include "AccelByteVivoxTypes.h"
+#include <atomic>
 
-#if VIVOX_AVAILABLE
-#include "VivoxCore.h"
+// Verbose and VeryVerbose logs, such as per-participant ones, compile to nothing unless this is 1 (Debug builds by default)
+#ifndef ACCELBYTEVIVOX_VERBOSE_LOGGING
+#define ACCELBYTEVIVOX_VERBOSE_LOGGING 0
 #endif
 
+#if ACCELBYTEVIVOX_VERBOSE_LOGGING
 DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteVivox, Log, All);
+#else
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteVivox, Log, Log);
+#endif
 
 // Delegates
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnVivoxLoginCompleted, bool /*bSuccess*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnVivoxLoginCompletedWithTimings, bool /*bSuccess*/, const FAccelByteVivoxLoginTimings& /*Timings*/);
 DECLARE_MULTICAST_DELEGATE(FOnVivoxLogoutCompleted);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnVivoxChannelJoined, const FString& /*ChannelName*/, bool /*bSuccess*/);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnVivoxChannelLeft, const FString& /*ChannelName*/);
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnVivoxParticipantAdded, const FString& /*ChannelName*/, const FString& /*ParticipantId*/, const FString& /*DisplayName*/);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnVivoxParticipantRemoved, const FString& /*ChannelName*/, const FString& /*ParticipantId*/);
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnVivoxParticipantTalkingChanged, const FString& /*ChannelName*/, const FString& /*ParticipantId*/, bool /*bIsTalking*/);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnVivoxParticipantTalkingChangedByHandle, FAccelByteVivoxChannelHandle /*Channel*/, FAccelByteVivoxParticipantHandle /*Participant*/, bool /*bIsTalking*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnVivoxParticipantTalkingBatch, const FAccelByteVivoxTalkingChangeSet& /*Changes*/);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnVivoxReconnecting, const FString& /*ChannelName*/, int32 /*Attempt*/, float /*DelaySeconds*/);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnVivoxReconnected, const FString& /*ChannelName*/, bool /*bSuccess*/, double /*RecoverySeconds*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnVivoxChannelEvicted, const FString& /*ChannelName*/, const FString& /*JoiningChannelName*/);
+DECLARE_DELEGATE_OneParam(FOnVivoxJoinChannelsCompleted, const TMap<FString, bool>& /*Results*/);
+DECLARE_DELEGATE_OneParam(FOnVivoxSwitchChannelCompleted, bool /*bSuccess*/);
+DECLARE_DELEGATE_OneParam(FOnVivoxPlayersMuteCompleted, const TMap<FString, bool>& /*Results*/);
+DECLARE_DELEGATE_OneParam(FOnVivoxShutdownCompleted, bool /*bDrained*/);
 
 using FAccelByteVivoxVoiceChatPtr = TSharedPtr<class FAccelByteVivoxVoiceChat, ESPMode::ThreadSafe>;
 
-class ACCELBYTEVIVOX_API FAccelByteVivoxVoiceChat : public TSharedFromThis<FAccelByteVivoxVoiceChat, ESPMode::ThreadSafe>
+class ACCELBYTEVIVOX_API FAccelByteVivoxVoiceChat
+	: public TSharedFromThis<FAccelByteVivoxVoiceChat, ESPMode::ThreadSafe>
+	, public IAccelByteVivoxBackendListener
 {
 public:
 	static FAccelByteVivoxVoiceChatPtr Get();
@@ -35,17 +59,89 @@ public:
 	// Lifecycle
 	void Initialize();
 	void Uninitialize();
+	bool IsInitialized() const;
+	// Non-blocking Uninitialize: every channel is disconnected at once, and the teardown waits on ticks for the disconnects
+	// to be confirmed, up to ShutdownDrainTimeoutSeconds, before it logs out and uninitializes. bDrained is false when the
+	// deadline forced it. Logins and joins are refused meanwhile; Uninitialize() forces it right away.
+	void BeginShutdown(const FOnVivoxShutdownCompleted& OnCompleted = FOnVivoxShutdownCompleted());
+	bool IsShuttingDown() const;
+	// Blocks until the shutdown in progress is done, pumping the backend itself, for when nothing ticks any more
+	void FinishShutdown();
+	// Backend events are queued on arrival, from any thread, and processed on the game thread at the start of each tick,
+	// participant events within EventProcessingBudgetMs
+	FAccelByteVivoxEventQueueStats GetEventQueueStats() const;
+
+	// Backend — VivoxCore by default; replace before Initialize() to run against another implementation
+	void SetBackend(const FAccelByteVivoxBackendPtr& InBackend);
+	FAccelByteVivoxBackendPtr GetBackend() const;
 
 	// Login / Logout
-	void Login(const AccelByte::FApiClientPtr& ApiClient, const FString& InUsername);
+	// The handle is invalid when the login fails, or is refused, before Login() returns
+	FAccelByteVivoxOperationHandle Login(const AccelByte::FApiClientPtr& ApiClient, const FString& InUsername);
+	// Starts the login token request early, e.g. while the game is still loading; may be called before Initialize().
+	// A later Login() for the same user picks the token up, or waits on the request if it is still in flight.
+	void PrefetchLoginToken(const AccelByte::FApiClientPtr& ApiClient, const FString& InUsername);
 	void Logout();
 	bool IsLoggedIn() const;
 
+	// Cancellation — abandons a Login or JoinChannel still in flight, which then completes with false. One cancelled
+	// before its token arrived drops the token and never starts the Vivox login or channel connect; one cancelled later
+	// is logged out or left. A join shared by several JoinChannel calls goes on until all of them are cancelled.
+	// False if the operation has already completed.
+	bool CancelOperation(FAccelByteVivoxOperationHandle Operation);
+	FAccelByteVivoxCancellationStats GetCancellationStats() const;
+
+	// Reconnect — with bAutoReconnect set, a dropped login session or channel is restored with jittered exponential
+	// backoff. ChannelName is empty in OnReconnecting / OnReconnected when the event is about the login session.
+	bool IsReconnecting() const;
+	FAccelByteVivoxReconnectStats GetReconnectStats() const;
+
 	// Channel management
-	void JoinChannel(const FString& ChannelName);
+	// A JoinChannel for a channel whose join is still in flight shares it: one token request, one connect, one OnChannelJoined
+	// The handle is invalid when the join completes, or fails, before JoinChannel returns
+	FAccelByteVivoxOperationHandle JoinChannel(const FString& ChannelName);
+	// Joins every channel concurrently; OnChannelJoined still fires per channel, OnCompleted once all have finished
+	void JoinChannels(const TArray<FString>& ChannelNames, const FOnVivoxJoinChannelsCompleted& OnCompleted = FOnVivoxJoinChannelsCompleted());
+	// Fetches and caches a join token so a later JoinChannel can connect without waiting on the network
+	void PrefetchJoinToken(const FString& ChannelName);
+	// Also cancels the join of a channel that is still waiting on its token
 	void LeaveChannel(const FString& ChannelName);
 	void LeaveAllChannels();
 	bool IsInChannel(const FString& ChannelName) const;
+	// True from JoinChannel until OnChannelJoined fires for the channel
+	bool IsJoiningChannel(const FString& ChannelName) const;
+	// Make-before-break: joins ToChannelName, or promotes it from standby, moves transmission to it if it was going to
+	// FromChannelName, and leaves FromChannelName ChannelSwitchOverlapSeconds later. OnCompleted fires once FromChannelName
+	// has disconnected, or with false if ToChannelName could not be joined, in which case FromChannelName is kept.
+	void SwitchChannel(const FString& FromChannelName, const FString& ToChannelName,
+		const FOnVivoxSwitchChannelCompleted& OnCompleted = FOnVivoxSwitchChannelCompleted());
+
+	// Channel budget — at most MaxConcurrentChannels are held at once. A join past the budget evicts the lowest priority,
+	// least recently active channel, reported through OnChannelEvicted. Priorities may be set before the channel is joined.
+	void SetChannelPriority(const FString& ChannelName, EAccelByteVivoxChannelPriority Priority);
+	EAccelByteVivoxChannelPriority GetChannelPriority(const FString& ChannelName) const;
+	// Lowering the budget below the channels held evicts the excess right away
+	void SetMaxConcurrentChannels(int32 MaxChannels);
+	int32 GetMaxConcurrentChannels() const;
+
+	// Positional channels — 3D voice attenuated by distance. Set3DPosition may be called every frame: each positional
+	// channel is sent at most PositionUpdateRateHz updates per second, and only once the pose has moved further than
+	// PositionUpdateDistanceThreshold or turned further than PositionUpdateAngleThresholdDegrees since the last one.
+	FAccelByteVivoxOperationHandle JoinPositionalChannel(const FString& ChannelName,
+		const FAccelByteVivoxPositionalProperties& Properties = FAccelByteVivoxPositionalProperties());
+	bool IsPositionalChannel(const FString& ChannelName) const;
+	void Set3DPosition(const FVector& SpeakerPosition, const FVector& ListenerPosition, const FVector& ListenerForward, const FVector& ListenerUp);
+	// Speaker and listener at the same place, e.g. the camera or the pawn
+	void Set3DPosition(const FVector& Position, const FRotator& Rotation);
+	FAccelByteVivoxPositionUpdateStats GetPositionUpdateStats() const;
+
+	// Standby channels — connected, but their audio is muted and they are never transmitted to, so promoting one only
+	// changes the mute and transmission state. While any channel is on standby, transmission to all goes to the one active
+	// channel, or nowhere if there are several, since VivoxCore cannot leave channels out of it.
+	FAccelByteVivoxOperationHandle JoinStandbyChannel(const FString& ChannelName);
+	void PromoteStandbyChannel(const FString& ChannelName, bool bSetTransmission = true);
+	void DemoteToStandby(const FString& ChannelName);
+	bool IsStandbyChannel(const FString& ChannelName) const;
 
 	// Transmission — controls which channel receives your microphone audio
 	void SetTransmissionChannel(const FString& ChannelName);
@@ -57,17 +153,90 @@ public:
 	bool IsLocalMuted() const;
 	void SetPlayerMute(const FString& ChannelName, const FString& PlayerId, bool bMuted);
 	bool IsPlayerMuted(const FString& ChannelName, const FString& PlayerId) const;
+	// Bulk mute — every mute request is issued up front and OnCompleted fires once, with a result per player that is
+	// true only if the player was found and muted in every channel the call covers
+	void SetPlayersMute(const FString& ChannelName, const TArray<FString>& PlayerIds, bool bMuted,
+		const FOnVivoxPlayersMuteCompleted& OnCompleted = FOnVivoxPlayersMuteCompleted());
+	void MutePlayerEverywhere(const FString& PlayerId, bool bMuted,
+		const FOnVivoxPlayersMuteCompleted& OnCompleted = FOnVivoxPlayersMuteCompleted());
+	void MutePlayerEverywhere(const TArray<FString>& PlayerIds, bool bMuted,
+		const FOnVivoxPlayersMuteCompleted& OnCompleted = FOnVivoxPlayersMuteCompleted());
+
+	// Block list — blocked players are muted in every channel, and by the backend as soon as they join one.
+	// Changing the list mutes or unmutes the affected players wherever they are now.
+	void SetBlockedPlayers(const TArray<FString>& PlayerIds);
+	void BlockPlayer(const FString& PlayerId);
+	void UnblockPlayer(const FString& PlayerId);
+	bool IsPlayerBlocked(const FString& PlayerId) const;
+	const TSet<FString>& GetBlockedPlayers() const;
+	// Done automatically when bPersistBlockList is set
+	bool LoadBlockList();
+	bool SaveBlockList() const;
+
+	// Handles — integer ids for joined channels and their participants, valid until the channel or participant is gone
+	FAccelByteVivoxChannelHandle GetChannelHandle(const FString& ChannelName) const;
+	FAccelByteVivoxParticipantHandle GetParticipantHandle(FAccelByteVivoxChannelHandle Channel, const FString& ParticipantId) const;
+	const FString* GetChannelName(FAccelByteVivoxChannelHandle Channel) const;
+	const FString* GetParticipantId(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant) const;
+	const FString* GetParticipantDisplayName(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant) const;
+
+	// Roster queries — served from the local participant table; OutParticipants is reset, not reallocated, on each call
+	int32 GetParticipantCount(const FString& ChannelName) const;
+	int32 GetParticipantCount(FAccelByteVivoxChannelHandle Channel) const;
+	bool IsTalking(const FString& ChannelName, const FString& PlayerId) const;
+	bool IsTalking(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant) const;
+	void GetTalkingParticipants(const FString& ChannelName, TArray<FString>& OutParticipantIds) const;
+	void GetTalkingParticipants(FAccelByteVivoxChannelHandle Channel, TArray<FAccelByteVivoxParticipantHandle>& OutParticipants) const;
+
+	// Talking events — when coalesced, changes are delivered once per tick through OnParticipantTalkingBatch only
+	void SetCoalesceTalkingEvents(bool bCoalesce);
+	bool IsCoalescingTalkingEvents() const;
+
+	// Talking hysteresis — a change must hold for the attack (start) or release (stop) time before it is applied.
+	// Per-channel values override the settings and may be set before the channel is joined.
+	void SetChannelTalkingHysteresis(const FString& ChannelName, float AttackSeconds, float ReleaseSeconds);
+	void ResetChannelTalkingHysteresis(const FString& ChannelName);
+	FAccelByteVivoxTalkingStats GetTalkingStats() const;
+	FAccelByteVivoxTalkingStats GetTalkingStats(const FString& ChannelName) const;
+	void ResetTalkingStats();
+
+	// Audio energy — sampled at AudioEnergySampleRateHz for subscribed channels only. Subscriptions are counted and
+	// may be made before the channel is joined. The snapshot pointer is valid until the channel is left.
+	void SubscribeAudioEnergy(const FString& ChannelName);
+	void UnsubscribeAudioEnergy(const FString& ChannelName);
+	const FAccelByteVivoxAudioEnergySnapshot* GetAudioEnergySnapshot(const FString& ChannelName) const;
+	const FAccelByteVivoxAudioEnergySnapshot* GetAudioEnergySnapshot(FAccelByteVivoxChannelHandle Channel) const;
+
+	// Latency — every successful login and join stage is timed into a histogram per EAccelByteVivoxLatencyStage
+	FAccelByteVivoxLatencySummary GetLatencySummary(EAccelByteVivoxLatencyStage Stage) const;
+	const FAccelByteVivoxLatencyHistogram& GetLatencyHistogram(EAccelByteVivoxLatencyStage Stage) const;
+	void ResetLatencyStats();
+	// One row per stage, times in milliseconds. Saved to Saved/AccelByteVivox/Latency.csv when no path is given.
+	FString GetLatencyStatsCsv() const;
+	bool SaveLatencyStatsCsv(const FString& FilePath = FString()) const;
 
 	// Delegates
 	FOnVivoxLoginCompleted OnLoginCompleted;
+	// Same events as OnLoginCompleted, with the time spent in each login stage
+	FOnVivoxLoginCompletedWithTimings OnLoginCompletedWithTimings;
 	FOnVivoxLogoutCompleted OnLogoutCompleted;
 	FOnVivoxChannelJoined OnChannelJoined;
 	FOnVivoxChannelLeft OnChannelLeft;
 	FOnVivoxParticipantAdded OnParticipantAdded;
 	FOnVivoxParticipantRemoved OnParticipantRemoved;
 	FOnVivoxParticipantTalkingChanged OnParticipantTalkingChanged;
+	// Same events as OnParticipantTalkingChanged, without the strings
+	FOnVivoxParticipantTalkingChangedByHandle OnParticipantTalkingChangedByHandle;
+	FOnVivoxParticipantTalkingBatch OnParticipantTalkingBatch;
+	FOnVivoxReconnecting OnReconnecting;
+	FOnVivoxReconnected OnReconnected;
+	// JoiningChannelName is empty when the channel was evicted by lowering the budget
+	FOnVivoxChannelEvicted OnChannelEvicted;
 
 private:
+	// Drives ticks and event processing directly, see AccelByteVivoxBenchmark.h
+	friend class FAccelByteVivoxBenchmarkRunner;
+
 	enum class EVivoxLoginState : uint8
 	{
 		NotLoggedIn,
@@ -78,34 +247,437 @@ private:
 	EVivoxLoginState CurrentLoginState = EVivoxLoginState::NotLoggedIn;
 	FString Username;
 	AccelByte::FApiClientPtr ApiClientPtr;
+	// Bumped by every Login() so completions from an earlier attempt are ignored
+	uint32 LoginAttempt = 0;
 	bool bLocalMuted = false;
 
-#if VIVOX_AVAILABLE
-	IClient* VivoxVoiceClient = nullptr;
-	ILoginSession* VivoxLoginSession = nullptr;
-	AccountId VivoxAccountId;
-	TMap<FString, IChannelSession*> ChannelSessions;
+	// The login token being requested or held for Username, whether by Login() or a prefetch
+	struct FLoginToken
+	{
+		FString Username;
+		// Zero when no request is outstanding
+		uint32 RequestId = 0;
+		double RequestedAt = 0.0;
+		double ReceivedAt = 0.0;
+		bool bReceived = false;
+		FString AccessToken;
+		FString Uri;
+	};
+	FLoginToken LoginToken;
+	uint32 LastLoginTokenRequestId = 0;
+	double LoginStartedAt = 0.0;
+	double SessionLoginStartedAt = 0.0;
+	FAccelByteVivoxLoginTimings LoginTimings;
+	// Handle returned by the Login() in progress
+	FAccelByteVivoxOperationHandle LoginOperation;
+
+	bool IsLoginTokenUsable(const FString& InUsername) const;
+	void RequestLoginToken(const AccelByte::FApiClientPtr& ApiClient, const FString& InUsername);
+	void BeginLoginSession();
+	void CompleteLogin(bool bSuccess);
+	void BroadcastLoginCompleted(bool bSuccess, const FAccelByteVivoxLoginTimings& Timings);
+	bool CancelLogin();
+
+	uint32 LastOperationHandle = 0;
+	// JoinChannel handles still in flight, with the channel they join
+	TMap<FAccelByteVivoxOperationHandle, FString> JoinOperations;
+	FAccelByteVivoxCancellationStats CancellationStats;
+
+	// Last transmission call, reapplied after a reconnect
+	enum class ETransmissionMode : uint8
+	{
+		Default,
+		Channel,
+		All,
+		None
+	};
+	ETransmissionMode TransmissionMode = ETransmissionMode::Default;
+	FString TransmissionChannelName;
+
+	// Sends TransmissionMode to the backend, leaving standby channels out
+	void ApplyTransmission();
+	bool HasStandbyChannels() const;
+
+	// Login session being restored after an unexpected logout; lost channels wait in ChannelRejoins until it is back
+	struct FLoginRecovery
+	{
+		bool bActive = false;
+		bool bInFlight = false;
+		bool bChannelsFailed = false;
+		int32 Attempt = 0;
+		double LostAt = 0.0;
+		double NextAttemptAt = 0.0;
+	};
+	FLoginRecovery LoginRecovery;
+
+	struct FChannelRejoin
+	{
+		bool bInFlight = false;
+		// LeaveChannel was called while the rejoin was in flight
+		bool bCancelled = false;
+		int32 Attempt = 0;
+		double LostAt = 0.0;
+		double NextAttemptAt = 0.0;
+		TSet<FString> MutedPlayers;
+		bool bPositional = false;
+		FAccelByteVivoxPositionalProperties PositionalProperties;
+		bool bStandby = false;
+	};
+	TMap<FString, FChannelRejoin> ChannelRejoins;
+	FAccelByteVivoxReconnectStats ReconnectStats;
+
+	bool ScheduleReconnectAttempt(const FString& ChannelName, int32& Attempt, double& NextAttemptAt);
+	void UpdateReconnect();
+	void HandleLoginRecoveryResult(bool bSuccess);
+	void AbandonLoginRecovery();
+	void HandleChannelRejoinResult(const FString& ChannelName, bool bSuccess);
+	void CompleteLoginRecoveryIfDone();
+	double RecordRecovery(double LostAt);
+	void CancelReconnect();
+
+	FAccelByteVivoxLatencyHistogram LatencyHistograms[static_cast<int32>(EAccelByteVivoxLatencyStage::Count)];
+	void RecordLatency(EAccelByteVivoxLatencyStage Stage, double Seconds);
+	// Joins waiting on OnChannelJoined, by channel name
+	struct FPendingJoin
+	{
+		double StartedAt = 0.0;
+		// JoinChannel calls sharing this join that have not been cancelled
+		TArray<FAccelByteVivoxOperationHandle, TInlineAllocator<1>> Operations;
+	};
+	TMap<FString, FPendingJoin> PendingJoins;
+
+	// Drops the token request of a join that has no channel session yet and fails the join; false if it has one
+	bool CancelJoinBeforeConnect(const FString& ChannelName);
+
+	// Broadcasts OnChannelJoined and resolves any JoinChannels batch waiting on the channel
+	void CompleteChannelJoin(const FString& ChannelName, bool bSuccess);
+
+	struct FJoinChannelsBatch
+	{
+		TSet<FString> PendingChannels;
+		TMap<FString, bool> Results;
+		FOnVivoxJoinChannelsCompleted OnCompleted;
+	};
+	TMap<int32, FJoinChannelsBatch> JoinChannelsBatches;
+	int32 NextJoinChannelsBatchId = 0;
+
+	struct FChannelSwitch
+	{
+		FString FromChannelName;
+		FString ToChannelName;
+		FOnVivoxSwitchChannelCompleted OnCompleted;
+		// ToChannelName is up and FromChannelName is left at LeaveFromAt
+		bool bJoined = false;
+		double LeaveFromAt = 0.0;
+		// The switch completes once FromChannelName's session is gone
+		bool bLeaveFromRequested = false;
+	};
+	TArray<FChannelSwitch> ChannelSwitches;
+
+	void HandleChannelSwitchJoinResult(const FString& ChannelName, bool bSuccess);
+	void UpdateChannelSwitches();
+	void CompleteLeftChannelSwitches();
+
+	struct FMuteBatch
+	{
+		TMap<FString, bool> Results;
+		int32 PendingRequests = 0;
+		FOnVivoxPlayersMuteCompleted OnCompleted;
+	};
+	TMap<uint32, FMuteBatch> MuteBatches;
+	uint32 LastMuteBatchId = 0;
+
+	TSet<FString> BlockedPlayers;
+	// Replaces the block list and applies the difference to the players currently in channels
+	void ApplyBlockedPlayers(TSet<FString>&& NewBlockedPlayers);
+	// The backend mutes blocked players itself as they join, so it needs every change to the list
+	void SyncBlockedPlayersToBackend();
+	void SaveBlockListIfPersistent() const;
+	static FString GetBlockListFilePath();
+
+	// Issues the backend mute request; BatchId is 0 for a single SetPlayerMute
+	int32 BeginParticipantMute(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		const FString& PlayerId, bool bMuted, uint32 BatchId);
+	void AddPlayerToMuteBatch(FMuteBatch& Batch, uint32 BatchId, FAccelByteVivoxChannelHandle Channel, const FString& PlayerId, bool bMuted);
+	void CompleteMuteBatchRequest(uint32 BatchId, const FString& PlayerId, bool bSuccess);
+	void IssueMuteBatch(uint32 BatchId, FMuteBatch&& Batch);
+
+	FAccelByteVivoxBackendPtr Backend;
+	bool bInitialized = false;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	bool Tick(float DeltaTime);
+
+	// Started by BeginShutdown; waits on the channels still in Channels
+	struct FPendingShutdown
+	{
+		bool bActive = false;
+		double StartedAt = 0.0;
+		double Deadline = 0.0;
+		FOnVivoxShutdownCompleted OnCompleted;
+	};
+	FPendingShutdown PendingShutdown;
+
+	void UpdateShutdown();
+	void CompleteShutdown(bool bDrained);
+
+	void ApplyElapsedTalkingHolds();
+	void SampleAudioEnergy();
+	// Channel and participant counts for Unreal Insights, only while the AccelByteVivox trace channel is on
+	void TraceCounters() const;
+	void FlushTalkingChanges();
+
+	enum class EQueuedEventType : uint8
+	{
+		LoginTokenReceived,
+		LoginTokenFailed,
+		LoginCompleted,
+		LoggedOut,
+		JoinTokenReceived,
+		JoinTokenFailed,
+		ChannelConnectCompleted,
+		ChannelDisconnected,
+		ParticipantMuteCompleted
+	};
+
+	// One inbound backend event, other than a participant event; only the fields its type needs are set
+	struct FQueuedEvent
+	{
+		EQueuedEventType Type = EQueuedEventType::LoggedOut;
+		FAccelByteVivoxChannelHandle Channel;
+		FAccelByteVivoxParticipantHandle Participant;
+		// Login attempt for login completions, token request for login and join tokens, batch for mute completions
+		uint32 RequestId = 0;
+		int32 Error = 0;
+		// bMuted for mute completions
+		bool bValue = false;
+		FString ChannelName;
+		FString ParticipantId;
+		FString AccessToken;
+		FString Uri;
+		FString ErrorMessage;
+	};
+
+	enum class ERosterEventType : uint8
+	{
+		ParticipantAdded,
+		ParticipantRemoved,
+		ParticipantUpdated
+	};
+
+	// Participant events carry handles only, so queuing one copies a few bytes; the wrapper reads the id and display
+	// name of an added participant from the backend when it processes the event
+	struct FRosterEvent
+	{
+		ERosterEventType Type = ERosterEventType::ParticipantUpdated;
+		// bMutedByBackend for adds, bSpeechDetected for updates
+		bool bValue = false;
+		float AudioEnergy = 0.0f;
+		FAccelByteVivoxChannelHandle Channel;
+		FAccelByteVivoxParticipantHandle Participant;
+	};
+
+	// Login, token, channel and mute events go in the control lane, which is always drained first and in full.
+	// Participant events go in the roster lane, a fixed-size lock-free ring drained within the per-tick budget.
+	TQueue<FQueuedEvent, EQueueMode::Mpsc> ControlEventQueue;
+	TAccelByteVivoxEventRing<FRosterEvent> RosterEventQueue;
+	std::atomic<int32> QueuedControlEventCount { 0 };
+	std::atomic<int32> QueuedRosterEventCount { 0 };
+	// Participant events that found the ring full
+	std::atomic<uint64> DroppedRosterUpdateCount { 0 };
+	std::atomic<uint64> DroppedRosterMembershipCount { 0 };
+	uint64 ReportedRosterMembershipDrops = 0;
+	FAccelByteVivoxEventQueueStats EventQueueStats;
+
+	void EnqueueEvent(FQueuedEvent&& Event);
+	void EnqueueRosterEvent(ERosterEventType Type, FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		bool bValue = false, float AudioEnergy = 0.0f);
+	void ProcessQueuedEvents();
+	void ProcessEvent(FQueuedEvent& Event);
+	void ProcessRosterEvent(const FRosterEvent& Event);
 
 	// Internal helpers
-	void HandleLoginTokenResponse(const FString& AccessToken, const FString& Uri);
-	void HandleVivoxLoginCompleted(VivoxCoreError Error);
-	void HandleLoginSessionStateChanged(LoginState State);
+	void HandleLoginTokenReceived(const FString& AccessToken, const FString& Uri);
+	void HandleLoginTokenFailed(int32 ErrorCode, const FString& ErrorMessage);
+	void HandleVivoxLoginCompleted(int32 Error);
+	void HandleLoggedOut();
 
+	void RequestJoinToken(const FString& ChannelName, bool bJoinOnResponse);
+	void HandleJoinTokenReceived(const FString& ChannelName, uint32 RequestId, const FString& AccessToken, const FString& Uri);
+	void HandleJoinTokenFailed(const FString& ChannelName, uint32 RequestId, int32 ErrorCode, const FString& ErrorMessage);
+	bool ConsumeCachedJoinToken(const FString& ChannelName, bool bPositional, FString& OutAccessToken, FString& OutUri);
+	void PurgeExpiredJoinTokens();
+	void DropJoinTokens();
 	void HandleJoinTokenResponse(const FString& ChannelName, const FString& AccessToken, const FString& Uri);
-	void HandleChannelConnectCompleted(const FString& ChannelName, VivoxCoreError Error);
-	void HandleChannelStateChanged(const FString& ChannelName, const IChannelConnectionState& State);
-	void CleanUpChannelSession(const FString& ChannelName);
+	void HandleChannelConnectCompleted(FAccelByteVivoxChannelHandle Channel, const FString& ChannelName, int32 Error);
+	void CleanUpChannelSession(FAccelByteVivoxChannelHandle Channel);
+	void HandleChannelDisconnected(FAccelByteVivoxChannelHandle Channel);
+	void BeginChannelRejoin(const FChannelState& ChannelState, double LostAt);
+	void RestorePlayerMutes(FChannelState& ChannelState);
+	void HandleParticipantAdded(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant, bool bMutedByBackend);
+	void HandleParticipantRemoved(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant);
+	void HandleParticipantUpdated(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		bool bSpeechDetected, float AudioEnergy);
+	void HandleParticipantMuteCompleted(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		const FString& PlayerId, bool bMuted, int32 Error, uint32 BatchId);
 
-	// Participant event handlers
-	void HandleParticipantAdded(const IParticipant& Participant);
-	void HandleParticipantRemoved(const IParticipant& Participant);
-	void HandleParticipantUpdated(const IParticipant& Participant);
+	// IAccelByteVivoxBackendListener; may be called from any thread, so these only queue the event
+	virtual void OnBackendLoggedOut() override;
+	virtual void OnBackendChannelDisconnected(FAccelByteVivoxChannelHandle Channel) override;
+	virtual void OnBackendParticipantAdded(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		bool bMuted) override;
+	virtual void OnBackendParticipantRemoved(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant) override;
+	virtual void OnBackendParticipantUpdated(FAccelByteVivoxChannelHandle Channel, FAccelByteVivoxParticipantHandle Participant,
+		bool bSpeechDetected, float AudioEnergy) override;
 
-	// Track talking state per participant to detect changes
-	TMap<FString, TMap<FString, bool>> ParticipantTalkingState;
+	// Join tokens fetched ahead of JoinChannel, consumed on first use
+	struct FCachedJoinToken
+	{
+		FString AccessToken;
+		FString Uri;
+		double ExpiresAt = 0.0;
+		bool bPositional = false;
+	};
+	TMap<FString, FCachedJoinToken> JoinTokenCache;
 
-	// Delegate handles for cleanup
-	FDelegateHandle LoginSessionStateChangedHandle;
-	TMap<FString, FDelegateHandle> ChannelStateChangedHandles;
-#endif
+	// Join token requests in flight; bJoinRequested is set once JoinChannel is waiting on the response.
+	// A newer request for the same channel replaces the entry, and responses to the older one are dropped.
+	struct FPendingJoinToken
+	{
+		uint32 RequestId = 0;
+		double RequestedAt = 0.0;
+		bool bJoinRequested = false;
+		bool bPositional = false;
+	};
+	TMap<FString, FPendingJoinToken> PendingJoinTokens;
+	uint32 LastJoinTokenRequestId = 0;
+
+	// Properties of positional channels between JoinPositionalChannel and the join completing
+	TMap<FString, FAccelByteVivoxPositionalProperties> PositionalJoins;
+	// Channels between JoinStandbyChannel and the join completing
+	TSet<FString> StandbyJoins;
+
+	struct FListenerPose
+	{
+		FVector SpeakerPosition = FVector::ZeroVector;
+		FVector ListenerPosition = FVector::ZeroVector;
+		FVector ListenerForward = FVector::ForwardVector;
+		FVector ListenerUp = FVector::UpVector;
+	};
+	FListenerPose ListenerPose;
+	bool bListenerPoseSet = false;
+	// Some positional channel has not been sent the latest pose yet
+	bool bListenerPoseDirty = false;
+	FAccelByteVivoxPositionUpdateStats PositionUpdateStats;
+
+	void UpdatePositions();
+	static bool HasPoseChanged(const FListenerPose& SentPose, const FListenerPose& Pose);
+
+	// Joined channels, keyed by handle; names are only looked up at the API boundary.
+	// Participants are stored as parallel arrays indexed by a dense slot. Removing one moves the last slot into the
+	// hole, so slots are only stable between roster changes and handles remain the stable key.
+	struct FChannelState
+	{
+		FString ChannelName;
+		bool bConnected = false;
+		bool bLeaveRequested = false;
+		bool bStandby = false;
+		// Held only until a SwitchChannel away from it completes, so it is kept out of the channel budget
+		bool bSwitchingAway = false;
+		double ConnectStartedAt = 0.0;
+		bool bParticipantSeen = false;
+
+		EAccelByteVivoxChannelPriority Priority = EAccelByteVivoxChannelPriority::Normal;
+		// Joined, last transmitted to, or last had a participant start talking
+		double LastActiveAt = 0.0;
+
+		bool bPositional = false;
+		FAccelByteVivoxPositionalProperties PositionalProperties;
+		bool bPoseSent = false;
+		double PoseSentAt = 0.0;
+		FListenerPose SentPose;
+
+		// Players muted before the channel dropped, muted again as they show up in the rejoined channel
+		TSet<FString> MutesToRestore;
+		float TalkingAttackSeconds = 0.0f;
+		float TalkingReleaseSeconds = 0.0f;
+		FAccelByteVivoxTalkingStats TalkingStats;
+
+		bool bSampleAudioEnergy = false;
+		double NextAudioEnergySampleAt = 0.0;
+		FAccelByteVivoxAudioEnergySnapshot AudioEnergySnapshot;
+
+		TArray<FAccelByteVivoxParticipantHandle> ParticipantHandles;
+		TArray<FString> ParticipantIds;
+		TArray<FString> DisplayNames;
+		TBitArray<> Talking;
+		// Last state delivered to subscribers; differs from Talking only while a coalesced change is pending
+		TBitArray<> ReportedTalking;
+		TBitArray<> TalkingChangePending;
+		// Latest SDK state; differs from Talking while a change waits out its hold time, which started at RawChangedAt
+		TBitArray<> RawTalking;
+		TBitArray<> TalkingHoldPending;
+		TArray<double> RawChangedAt;
+		TBitArray<> Muted;
+		// Only written while bSampleAudioEnergy is set
+		TArray<float> AudioEnergies;
+		TArray<double> AudioEnergyUpdatedAt;
+
+		TMap<FAccelByteVivoxParticipantHandle, int32> ParticipantSlots;
+		TMap<FString, FAccelByteVivoxParticipantHandle> ParticipantHandlesById;
+
+		int32 Num() const { return ParticipantHandles.Num(); }
+		int32 FindSlot(FAccelByteVivoxParticipantHandle Participant) const;
+		int32 FindSlot(const FString& ParticipantId) const;
+		// Strings are copied into buffers taken from SpareStrings and handed back to it on removal
+		int32 AddParticipant(FAccelByteVivoxParticipantHandle Participant, const FString& ParticipantId, const FString& DisplayName,
+			TArray<FString>& SpareStrings);
+		// OutParticipantId, if given, receives the removed id instead of SpareStrings
+		void RemoveParticipantAt(int32 Slot, TArray<FString>& SpareStrings, FString* OutParticipantId = nullptr);
+	};
+	TMap<FAccelByteVivoxChannelHandle, FChannelState> Channels;
+	TMap<FString, FAccelByteVivoxChannelHandle> ChannelHandlesByName;
+
+	TMap<FString, EAccelByteVivoxChannelPriority> ChannelPriorities;
+	int32 MaxConcurrentChannels = 0;
+
+	int32 GetBudgetedChannelCount() const;
+	// The channel a join of the given priority may evict, or an invalid handle if every channel outranks it
+	FAccelByteVivoxChannelHandle FindChannelToEvict(EAccelByteVivoxChannelPriority MaxPriority) const;
+	// Evicts channels until one more fits; false if that would take a channel above MaxPriority
+	bool MakeRoomForChannel(const FString& ChannelName, EAccelByteVivoxChannelPriority MaxPriority);
+	void EvictChannel(FAccelByteVivoxChannelHandle Channel, const FString& JoiningChannelName);
+	// The channel losing the microphone was last transmitted to now
+	void MarkTransmissionChannelActive();
+
+	// Reverse index of the rosters: the channels each participant is currently in
+	TMap<FString, TArray<FAccelByteVivoxChannelHandle, TInlineAllocator<4>>> PlayerChannels;
+	void RemovePlayerChannel(const FString& PlayerId, FAccelByteVivoxChannelHandle Channel);
+
+	// Id and display name buffers of removed participants, reused by later adds so roster churn does not allocate
+	TArray<FString> SpareParticipantStrings;
+	// Id and display name of the participant being added, read from the backend into buffers reused by every add
+	FString AddedParticipantId;
+	FString AddedParticipantDisplayName;
+	// Copy of the channel name passed to OnParticipantRemoved, since a handler may leave the channel
+	FString RemovedParticipantChannelName;
+	uint32 LastChannelHandle = 0;
+
+	void ApplyTalkingChange(FAccelByteVivoxChannelHandle Channel, FChannelState& ChannelState, int32 Slot, bool bTalking);
+
+	struct FTalkingHysteresis
+	{
+		float AttackSeconds = 0.0f;
+		float ReleaseSeconds = 0.0f;
+	};
+	TMap<FString, FTalkingHysteresis> ChannelTalkingHysteresis;
+	FAccelByteVivoxTalkingStats TalkingStats;
+	TArray<FAccelByteVivoxTalkingChange> ElapsedTalkingHolds;
+
+	TMap<FString, int32> AudioEnergySubscriptions;
+
+	bool bCoalesceTalkingEvents = false;
+	TArray<FAccelByteVivoxTalkingChange> PendingTalkingChanges;
+	// Reused every tick so delivering a batch does not allocate once the arrays have grown
+	FAccelByteVivoxTalkingChangeSet TalkingChangeSet;
 };